@@ -12,6 +12,11 @@
  * - NB_ITER: {1, 2, 4, 8} - iterations to complete buffer
  * - Total: 16 different configurations tested
  * 
+ * Alignment Sweep (ALIGN_SWEEP=1):
+ * - Byte offsets 0-7 applied to ext_buff0, ext_buff1 and loc_buff, one
+ *   misaligned buffer at a time (every combination with ALIGN_FULL_CUBE=1)
+ * - Transfer sizes that are not powers of two
+ *
  * Memory Flow: L2(ext_buff0) → L1(loc_buff) → process → L1(loc_buff) → L2(ext_buff1)
  */
 
@@ -19,211 +24,3889 @@
 #include "pmsis.h"
 #include "pmsis/cluster/dma/cl_dma.h"
 #include <stdio.h>
+#include <string.h>
 
 /*=============================================================================
  * CONFIGURATION PARAMETERS
  *============================================================================*/
 #define BUFF_SIZE 2048  // Fixed buffer size for consistent parameter comparison
 
+#define ALIGN_MAX_OFFSET 7                    // Largest byte offset applied to any buffer
+#define BUFF_PAD         (ALIGN_MAX_OFFSET+1) // Slack so offset buffers stay in bounds
+
+#ifndef ALIGN_SWEEP
+#define ALIGN_SWEEP 0   // 1: also sweep source/destination/L1 misalignment
+#endif
+#ifndef ALIGN_NB_COPY
+#define ALIGN_NB_COPY 2 // DMA chunks per iteration used by the alignment sweep
+#endif
+#ifndef ALIGN_NB_ITER
+#define ALIGN_NB_ITER 1 // Iterations used by the alignment sweep
+#endif
+#ifndef ALIGN_FULL_CUBE
+#define ALIGN_FULL_CUBE 0 // 1: every source x destination x L1 offset combination
+                          // 0: one misaligned buffer at a time, plus equal offsets on all three
+#endif
+#ifndef ALIGN_OFFSETS
+#define ALIGN_OFFSETS     0, 1, 2, 3, 4, 5, 6, 7  // Offsets shared by all three buffers
+#endif
+// Byte offsets swept by the alignment sweep, each 0..ALIGN_MAX_OFFSET,
+// e.g. -D'ALIGN_SRC_OFFSETS=0, 3'
+#ifndef ALIGN_SRC_OFFSETS
+#define ALIGN_SRC_OFFSETS ALIGN_OFFSETS     // Offsets of ext_buff0
+#endif
+#ifndef ALIGN_DST_OFFSETS
+#define ALIGN_DST_OFFSETS ALIGN_OFFSETS     // Offsets of ext_buff1
+#endif
+#ifndef ALIGN_LOC_OFFSETS
+#define ALIGN_LOC_OFFSETS ALIGN_OFFSETS     // Offsets of loc_buff
+#endif
+
+// Default transfer cost model (cycles, Q8 fixed point per byte). These are static
+// starting values; ALIGN_SWEEP refits the per-byte costs before its runs.
+#ifndef DMA_MODEL_CALIBRATE
+#define DMA_MODEL_CALIBRATE 1   // 1: ALIGN_SWEEP measures the *_CPB costs first, 0: keep the values below
+#endif
+#ifndef DMA_MODEL_SPLIT_CYCLES
+#define DMA_MODEL_SPLIT_CYCLES    20    // Fixed core cost of a split: phase checks and head/tail loops
+#endif
+#ifndef DMA_MODEL_ALIGNED_CPB
+#define DMA_MODEL_ALIGNED_CPB     64    // DMA cycles/byte when both ends are word aligned (0.25)
+#endif
+#ifndef DMA_MODEL_MISALIGNED_CPB
+#define DMA_MODEL_MISALIGNED_CPB  256   // DMA cycles/byte when either end is misaligned (1.0)
+#endif
+#ifndef DMA_MODEL_CORE_CPB
+#define DMA_MODEL_CORE_CPB        2560  // Core byte copy cycles/byte across L2 and L1 (10.0)
+#endif
+
+#ifndef L1_ARENA_SIZE
+#define L1_ARENA_SIZE 16384 // Single L1 reservation for tiles, descriptors and traces
+#endif
+
+#ifndef CL_NB_CORES
+#define CL_NB_CORES   8     // Cluster cores used by multi-core processing (and per-core result arrays)
+#endif
+
+#ifndef TCDM_NB_BANKS
+#define TCDM_NB_BANKS   16  // Word-interleaved L1 banks
+#endif
+#define TCDM_BANK_WIDTH 4   // Bytes per bank word
+
+#ifndef LAYOUT_SWEEP
+#define LAYOUT_SWEEP 0  // 1: compare contiguous vs bank-interleaved L1 layout
+#endif
+
+#ifndef CPU_BASELINE
+#define CPU_BASELINE 0  // 1: compare DMA against CPU-driven copies per transfer size
+#endif
+
+#ifndef HYBRID_SWEEP
+#define HYBRID_SWEEP 0  // 1: compare DMA-only against the size-threshold hybrid policy
+#endif
+// XFER_CALIB_THRESHOLD / XFER_CALIB_POLICY: crossover size and CPU copy
+// variant reported by a previous CPU_BASELINE run. When not given, the
+// hybrid sweep runs the baseline first to calibrate them.
+
+#ifndef COPY_PATH_SWEEP
+#define COPY_PATH_SWEEP 0   // 1: benchmark L2->L2 and L1->L1 copies (DMA, FC and cores)
+#endif
+
+#ifndef L3_STAGING
+#define L3_STAGING 0        // 1: stream BUFF_SIZE blocks L3 -> L2 -> L1 -> L2 -> L3
+#endif
+#ifndef L3_NB_BLOCKS
+#define L3_NB_BLOCKS 8      // Blocks staged in external RAM
+#endif
+#ifndef L3_NB_COPY
+#define L3_NB_COPY 2        // DMA chunks per iteration of the cluster pipeline on each block
+#endif
+#ifndef L3_NB_ITER
+#define L3_NB_ITER 1        // Iterations of the cluster pipeline on each block
+#endif
+
+#ifndef CONTENTION_SWEEP
+#define CONTENTION_SWEEP 0      // 1: FC generates L2 traffic while the cluster runs the pipeline
+#endif
+#ifndef CONTENTION_CHUNK
+#define CONTENTION_CHUNK 1024   // Bytes per FC memcpy / uDMA burst
+#endif
+#ifndef CONTENTION_IDLE_NOPS
+#define CONTENTION_IDLE_NOPS 512 // Length of an idle FC slot (no L2 data access)
+#endif
+
+// External RAM (BSP HyperRAM driver) is only needed by the L3 sweeps
+#if L3_STAGING || CONTENTION_SWEEP
+#include "bsp/ram.h"
+#include "bsp/ram/hyperram.h"
+#endif
+
+#ifndef ASYNC_SWEEP
+#define ASYNC_SWEEP 0   // 1: overlap FC fill/verify with the cluster using asynchronous dispatch
+#endif
+
+#ifndef WORKER_SWEEP
+#define WORKER_SWEEP 0      // 1: compare task-per-job dispatch with a persistent cluster worker
+#endif
+#ifndef WORKER_NB_JOBS
+#define WORKER_NB_JOBS 32   // Jobs per measurement
+#endif
+#define JOB_QUEUE_DEPTH 8   // Slots of the L2 job queue
+#define WORKER_MAX_COPY 8   // Largest NB_COPY a job may use (DMA handles held by the worker)
+
+#ifndef DISPATCH_BENCH
+#define DISPATCH_BENCH 0    // 1: also measure cluster open/close and team fork latency
+#endif
+#ifndef DISPATCH_NB_RUNS
+#define DISPATCH_NB_RUNS 8  // Repetitions per dispatch measurement (minimum is kept)
+#endif
+
+#ifndef NB_CLUSTERS
+#define NB_CLUSTERS 1       // >1: run the multi-cluster scaling benchmark on 1..NB_CLUSTERS clusters
+#endif
+#define MC_MAX_CLUSTERS 8   // Size of per-cluster arrays
+
+#ifndef SPECIALIZE_SWEEP
+#define SPECIALIZE_SWEEP 0  // 1: compare the runtime pipeline with compile-time specialized variants
+#endif
+// Build-time list of specialized (NB_COPY, NB_ITER) pipelines, size BUFF_SIZE.
+// Override with e.g. -D'SPEC_CONFIGS(X)=X(8, 1) X(8, 8)'
+#ifndef SPEC_CONFIGS
+#define SPEC_CONFIGS(X)                         \
+    X(1, 1) X(1, 2) X(1, 4) X(1, 8)             \
+    X(2, 1) X(2, 2) X(2, 4) X(2, 8)             \
+    X(4, 1) X(4, 2) X(4, 4) X(4, 8)             \
+    X(8, 1) X(8, 2) X(8, 4) X(8, 8)
+#endif
+
+#ifndef HAL_PATH_TEST
+#define HAL_PATH_TEST 0     // 1: check the HAL-level DMA path against pi_cl_dma_cmd
+#endif
+#define DMA_HAL_MAX_SIZE 0xFFFF     // Largest transfer of one MCHAN command (16-bit size field)
+
+#ifndef ISSUE_BENCH
+#define ISSUE_BENCH 0       // 1: measure DMA issue cycles per command (PMSIS vs HAL-level)
+#endif
+#ifndef ISSUE_NB_RUNS
+#define ISSUE_NB_RUNS 8     // Repetitions per issue measurement (minimum is kept)
+#endif
+#define ISSUE_MAX_COPY 8    // Largest NB_COPY measured by the issue benchmark
+
+#ifndef SCHEDULE_SWEEP
+#define SCHEDULE_SWEEP 0    // 1: compare the phased and the read/write interleaved DMA schedule
+#endif
+
+#ifndef VERIFY_MODE
+#define VERIFY_MODE 0   // 0: FC word-wise, 1: cluster-parallel, 2: checksum of the L1 tiles on the team
+#endif
+#ifndef VERIFY_TILE
+#define VERIFY_TILE 256 // Bytes per reference/result tile in cluster-parallel verification
+#endif
+
+#ifndef DATA_PATTERN
+#define DATA_PATTERN 0      // Source data: 0 random, 1 increment, 2 zero, 3 ones, 4 walking bit
+#endif
+#ifndef DATA_FILL_CLUSTER
+#define DATA_FILL_CLUSTER 0 // 1: CL_NB_CORES cores fill the source buffer (large BUFF_SIZE)
+#endif
+
+#ifndef PERF_PROFILE
+#define PERF_PROFILE 0  // 1: per-configuration cluster counter profile, 2: also per core
+#endif
+
+#ifndef ENERGY_ESTIMATE
+#define ENERGY_ESTIMATE 0   // 1: estimate energy per configuration (implies the counter profile)
+#endif
+
+// Energy table (pJ per event) used by ENERGY_ESTIMATE. Placeholder values of
+// the right order for a 22nm PULP cluster; replace with figures from power
+// simulation or measurement of the target.
+#ifndef ENERGY_PJ_CL_CYCLE
+#define ENERGY_PJ_CL_CYCLE     20   // Cluster clock tree, interconnect and leakage per cluster cycle
+#endif
+#ifndef ENERGY_PJ_CORE_ACTIVE
+#define ENERGY_PJ_CORE_ACTIVE  8    // One core active for one cycle
+#endif
+#ifndef ENERGY_PJ_DMA_BYTE
+#define ENERGY_PJ_DMA_BYTE     2    // One byte moved by the DMA (L2 + L1 access, engine)
+#endif
+#ifndef ENERGY_PJ_CORE_L2_BYTE
+#define ENERGY_PJ_CORE_L2_BYTE 4    // One byte moved by core loads/stores across L2 and L1
+#endif
+
+#ifndef TRACE_EVENTS
+#define TRACE_EVENTS 0      // 1: record DMA/compute events in L1 and dump them after each run
+#endif
+#ifndef TRACE_DEPTH
+#define TRACE_DEPTH 512     // Largest ring of one core; rings are sized per run up to it
+#endif
+
+// Events collected on every cluster core when profiling. Silicon
+// implementations with a single event counter only report one of them per run.
+#define PERF_PROFILE_EVENTS ((1 << PI_PERF_CYCLES) | (1 << PI_PERF_ACTIVE_CYCLES) | \
+                             (1 << PI_PERF_INSTR) | (1 << PI_PERF_LD_STALL) |      \
+                             (1 << PI_PERF_TCDM_CONT) | (1 << PI_PERF_IMISS))
+
 /*=============================================================================
  * GLOBAL MEMORY BUFFERS
  *============================================================================*/
-static char ext_buff0[BUFF_SIZE];   // Source buffer in L2 external memory
-static char ext_buff1[BUFF_SIZE];   // Destination buffer in L2 external memory  
+// Buffers are 8-byte aligned so that an offset of 0 really means aligned
+static char ext_buff0[BUFF_SIZE + BUFF_PAD] __attribute__((aligned(8)));   // Source buffer in L2 external memory
+static char ext_buff1[BUFF_SIZE + BUFF_PAD] __attribute__((aligned(8)));   // Destination buffer in L2 external memory
 static char *loc_buff;              // Processing buffer in L1 cluster memory (allocated dynamically)
 
-/*=============================================================================
- * PSEUDO-RANDOM NUMBER GENERATOR
- *============================================================================*/
-// Simple LCG for pseudo-random numbers
-static uint32_t lcg_seed = 1;      // Seed for Linear Congruential Generator
+static struct pi_device cluster_dev; // Cluster device, opened once for the whole sweep
+
+/*=============================================================================
+ * L1 ARENA ALLOCATOR
+ *============================================================================*/
+/**
+ * @brief Bump allocator over one L1 reservation
+ *
+ * All per-configuration L1 objects (tiles, DMA descriptors, traces) come
+ * from here. Nothing is freed individually: l1_arena_reset() releases
+ * everything in O(1) before the next configuration.
+ */
+typedef struct
+{
+    char *base;         // Start of the pmsis_l1_malloc reservation
+    uint32_t size;      // Bytes reserved
+    uint32_t top;       // Bytes handed out since the last reset
+} l1_arena_t;
+
+static l1_arena_t l1_arena;
+
+/**
+ * @brief Reserve the arena in L1 (cluster must be open)
+ * @return 0 on success, -1 if L1 is too small
+ */
+static int l1_arena_init(uint32_t size)
+{
+    l1_arena.base = pmsis_l1_malloc(size);
+    l1_arena.size = l1_arena.base ? size : 0;
+    l1_arena.top  = 0;
+    return l1_arena.base ? 0 : -1;
+}
+
+/**
+ * @brief Give the reservation back to the L1 allocator
+ */
+static void l1_arena_release(void)
+{
+    if (l1_arena.base)
+        pmsis_l1_malloc_free(l1_arena.base, l1_arena.size);
+    l1_arena.base = NULL;
+    l1_arena.size = 0;
+}
+
+/**
+ * @brief Allocate from the arena
+ * @param size  Bytes requested
+ * @param align Alignment in bytes (power of two)
+ * @return Aligned pointer, or NULL when the arena is exhausted
+ */
+static void *l1_arena_alloc(uint32_t size, uint32_t align)
+{
+    uint32_t addr = ((uint32_t)l1_arena.base + l1_arena.top + align - 1) & ~(align - 1);
+    uint32_t top  = addr - (uint32_t)l1_arena.base + size;
+
+    if (top > l1_arena.size)
+        return NULL;
+    l1_arena.top = top;
+    return (void *)addr;
+}
+
+/**
+ * @brief Release every arena allocation at once
+ */
+static inline void l1_arena_reset(void)
+{
+    l1_arena.top = 0;
+}
+
+/*=============================================================================
+ * TEST CONFIGURATION
+ *============================================================================*/
+/**
+ * @brief How the cluster moves each chunk between L2 and L1
+ */
+typedef enum
+{
+    XFER_DMA        = 0,    // One pi_cl_dma_cmd per chunk
+    XFER_SPLIT      = 1,    // Core copies misaligned head/tail, DMA moves aligned body
+    XFER_CPU_BYTE   = 2,    // Core copies the chunk byte by byte
+    XFER_CPU_WORD   = 3,    // Core copies the chunk word by word
+    XFER_CPU_UNROLL = 4,    // Core copies the chunk four words per step
+    XFER_HYBRID     = 5,    // CPU copy below the calibrated threshold, DMA above
+    XFER_HAL        = 6,    // One MCHAN command pushed through the HAL by dma_hal_memcpy()
+    XFER_NB_POLICIES
+} xfer_policy_e;
+
+#define XFER_IS_CPU(p) ((p) >= XFER_CPU_BYTE && (p) <= XFER_CPU_UNROLL)
+
+static const char *xfer_policy_names[XFER_NB_POLICIES] = {
+    "DMA", "SPLIT", "CPU_BYTE", "CPU_WORD", "CPU_UNROLL", "HYBRID", "HAL"
+};
+
+/**
+ * @brief Placement of the DMA tiles in L1
+ */
+typedef enum
+{
+    L1_LAYOUT_CONTIGUOUS  = 0,  // Tiles back to back, as the chunks sit in L2
+    L1_LAYOUT_INTERLEAVED = 1,  // Tiles padded so that consecutive tiles start in different banks
+    L1_NB_LAYOUTS
+} l1_layout_e;
+
+static const char *l1_layout_names[L1_NB_LAYOUTS] = {"CONTIG", "INTERLEAVED"};
+
+/**
+ * @brief Order of the DMA commands inside an iteration
+ */
+typedef enum
+{
+    SCHED_PHASED      = 0,  // All reads, process, all writes
+    SCHED_INTERLEAVED = 1,  // Write-back of chunk i in flight with the read of chunk i+1
+    SCHED_NB_MODES
+} dma_schedule_e;
+
+static const char *dma_schedule_names[SCHED_NB_MODES] = {"PHASED", "INTERLEAVED"};
+
+/**
+ * @brief Handle for a transfer issued through dma_xfer()
+ */
+typedef struct
+{
+    pi_cl_dma_cmd_t cmd;        // DMA command for the (aligned) body
+    int pending;                // XFER_PENDING_* until waited on
+    int hal_id;                 // Counter of a HAL-path command (XFER_PENDING_HAL)
+    int dma_bytes;              // Bytes moved by the DMA (the rest was copied by the core)
+} dma_xfer_t;
+
+#define XFER_PENDING_NONE  0    // Nothing to wait for (CPU copy or already waited)
+#define XFER_PENDING_PMSIS 1    // Wait on cmd with pi_cl_dma_cmd_wait()
+#define XFER_PENDING_HAL   2    // Wait on hal_id with dma_hal_wait()
+
+/**
+ * @brief Calibration data of the hybrid transfer policy
+ *
+ * Filled by cpu_baseline_sweep(), or taken from XFER_CALIB_* when a
+ * previous calibration is passed in at build time.
+ */
+typedef struct
+{
+    int valid;              // Non-zero once calibrated
+    int cpu_threshold;      // Chunks smaller than this are copied by the core
+    int cpu_policy;         // Fastest single-core XFER_CPU_* variant
+} xfer_calib_t;
+
+#ifdef XFER_CALIB_THRESHOLD
+#ifndef XFER_CALIB_POLICY
+#define XFER_CALIB_POLICY XFER_CPU_UNROLL
+#endif
+static xfer_calib_t xfer_calib = {1, XFER_CALIB_THRESHOLD, XFER_CALIB_POLICY};
+#else
+static xfer_calib_t xfer_calib = {0, 0, XFER_CPU_UNROLL};
+#endif
+
+/**
+ * @brief Where the output of a run is checked
+ */
+typedef enum
+{
+    VERIFY_FC       = 0,    // FC compares the whole output after the task
+    VERIFY_CLUSTER  = 1,    // Second cluster task compares tiles on all cores
+    VERIFY_CHECKSUM = 2,    // Team checksums each tile before write-back and the L2 output
+                            // after the task, FC compares checksums
+    VERIFY_NB_MODES
+} verify_mode_e;
+
+static const char *verify_mode_names[VERIFY_NB_MODES] = {"FC", "CLUSTER", "CHECKSUM"};
+
+/**
+ * @brief Position-weighted checksum of a byte stream
+ *
+ * Each byte contributes on its own (value and value * (index + 1)), so
+ * partial checksums over any split of the stream simply add up.
+ */
+typedef struct
+{
+    uint32_t sum;       // Sum of the bytes
+    uint32_t wsum;      // Sum of byte * (index + 1)
+} checksum_t;
+
+/**
+ * @brief Outcome of a verification pass
+ */
+typedef struct
+{
+    int first;          // Index of the first wrong byte, -1 if none
+    int count;          // Number of wrong bytes
+} verify_result_t;
+
+/**
+ * @brief Hardware counters of one cluster core over a whole cluster task
+ */
+typedef struct
+{
+    uint32_t cycles;        // PI_PERF_CYCLES
+    uint32_t active;        // PI_PERF_ACTIVE_CYCLES
+    uint32_t instr;         // PI_PERF_INSTR
+    uint32_t ld_stall;      // PI_PERF_LD_STALL
+    uint32_t tcdm_cont;     // PI_PERF_TCDM_CONT
+    uint32_t imiss;         // PI_PERF_IMISS
+} cl_perf_t;
+
+/**
+ * @brief Pipeline events recorded by the tracer
+ */
+typedef enum
+{
+    TR_READ_ISSUE  = 0,     // L2 -> L1 command issued (master)
+    TR_READ_DONE   = 1,     // L2 -> L1 command waited for (master)
+    TR_PROC_START  = 2,     // Core starts processing a tile
+    TR_PROC_END    = 3,     // Core finished processing a tile
+    TR_WRITE_ISSUE = 4,     // L1 -> L2 command issued (master)
+    TR_WRITE_DONE  = 5,     // L1 -> L2 command waited for (master)
+    TR_NB_EVENTS
+} trace_event_e;
+
+static const char *trace_event_names[TR_NB_EVENTS] = {
+    "READ_ISSUE", "READ_DONE", "PROC_START", "PROC_END", "WRITE_ISSUE", "WRITE_DONE"
+};
+
+#define TRACE_ALL_TILES 0xFFFF  // Tile index of an event covering the whole buffer
+
+/**
+ * @brief One trace record, 12 bytes
+ */
+typedef struct
+{
+    uint32_t ts;        // Cycle counter of the recording core
+    uint8_t core;       // Recording core
+    uint8_t event;      // trace_event_e
+    uint16_t tile;      // j*NB_COPY + i, or TRACE_ALL_TILES
+    uint32_t cmd;       // DMA command id (issue order), 0 for processing events
+} trace_record_t;
+
+/**
+ * @brief Per-core event ring in L1
+ */
+typedef struct
+{
+    uint32_t count;                     // Events recorded, may exceed depth
+    uint32_t depth;                     // Records in ev (the ring keeps the newest)
+    trace_record_t *ev;                 // Records in the L1 arena, NULL when depth is 0
+} trace_ring_t;
+
+/**
+ * @brief Parameters and results of a single DMA test run
+ *
+ * The FC fills in the parameters, run_dma_test() resolves the buffer
+ * addresses and records the results. The cluster task only reads it.
+ *
+ * Per-core results are sized by CL_NB_CORES, which keeps one configuration
+ * small enough for an FC stack local. Sweeps holding several configurations
+ * at once keep them in static storage.
+ */
+typedef struct
+{
+    // Parameters
+    int nb_copy;        // Number of DMA copies per iteration
+    int nb_iter;        // Number of iterations to complete buffer
+    int size;           // Bytes moved through the pipeline (any value <= BUFF_SIZE)
+    int src_off;        // Byte offset of the source inside ext_buff0
+    int dst_off;        // Byte offset of the destination inside ext_buff1
+    int loc_off;        // Byte offset of the working area inside loc_buff
+    int policy;         // Transfer policy used by the cluster (xfer_policy_e)
+    int nb_cores;       // Cores sharing the processing phase (0/1: master only)
+    int layout;         // Placement of the tiles in L1 (l1_layout_e)
+    int profile;        // Collect cl_perf_t on every cluster core
+    int copy_cores;     // Cores sharing XFER_CPU_* copies (0/1: master only)
+    int verify_mode;    // Where the output is checked (verify_mode_e, VERIFY_FC: VERIFY_MODE)
+    int energy;         // Estimate the energy of the run (turns the profile on)
+    int trace;          // Record pipeline events (turns the profile on)
+    void (*entry)(void *);  // Cluster task body (NULL: cluster_entry)
+    int schedule;       // Order of the DMA commands (dma_schedule_e)
+    int iter_proc;      // Phased schedule processes only the current iteration's tiles
+                        // (0: the whole buffer every iteration)
+    int standalone;     // Driven outside run_dma_test(), the caller checks the output:
+                        // no trace and no cluster-side verification work
+    int l1_ends;        // Source and destination are L1 images of ext_buff0/1, so both
+                        // transfer phases are L1->L1 copies (copy path benchmark)
+
+    // Resolved addresses (set by run_dma_test)
+    char *src;          // ext_buff0 + src_off
+    char *dst;          // ext_buff1 + dst_off
+    char *loc;          // loc_buff + loc_off
+    int tile_stride;    // L1 distance between tiles, 0 when contiguous
+    int cur_iter;       // Iteration in progress, read by process_tiles() (iter_proc)
+    dma_xfer_t *xfers;  // NB_COPY transfer handles, allocated in the L1 arena
+    char *verify_scratch;               // Per-core L1 tiles for VERIFY_CLUSTER
+    trace_ring_t *rings;                // CL_NB_CORES event rings in L1, NULL when not tracing
+
+    // Results
+    uint32_t cycles;    // FC cycles spent in the cluster task
+    int error;          // Non-zero if verification failed
+    verify_result_t verify;               // First wrong byte and number of wrong bytes
+    verify_result_t core_verify[CL_NB_CORES];   // Per-core results of VERIFY_CLUSTER
+    checksum_t checksum;                  // Checksum of the processed tiles (sum of core_checksum)
+    checksum_t core_checksum[CL_NB_CORES];  // Per-core partial checksums of the processed tiles
+    checksum_t expected;                  // Checksum of the expected output (sum of core_expected)
+    checksum_t core_expected[CL_NB_CORES];  // Per-core partials of expected, from the read-back task
+    checksum_t readback;                  // Checksum of the L2 output (sum of core_readback)
+    checksum_t core_readback[CL_NB_CORES];  // Per-core partials of readback, from the read-back task
+    uint32_t verify_cycles;               // FC cycles spent verifying
+    uint32_t readback_cycles;             // FC cycles of the VERIFY_CHECKSUM read-back task
+    uint32_t proc_cycles[CL_NB_CORES];    // Per-core cycles in the processing phase
+    uint32_t tcdm_cont[CL_NB_CORES];      // Per-core TCDM contention stalls in the processing phase
+    cl_perf_t perf[CL_NB_CORES];          // Per-core counter profile of the whole task
+    uint32_t phase_cycles[3];             // Master cycles in read/process/write phases (profiled runs)
+    uint32_t dma_bytes;                   // Bytes moved by the DMA in both directions
+    uint32_t energy_pj;                   // Estimated energy of the cluster task (pJ)
+} dma_test_t;
+
+/*=============================================================================
+ * TEST DATA GENERATOR
+ *============================================================================*/
+/**
+ * @brief Content written to the source buffer before each run
+ */
+typedef enum
+{
+    DATA_RANDOM      = 0,   // LCG words
+    DATA_INCREMENT   = 1,   // Byte i holds i & 0xFF
+    DATA_ZERO        = 2,   // All bytes 0x00
+    DATA_ONES        = 3,   // All bytes 0xFF
+    DATA_WALKING_BIT = 4,   // Word i holds 1 << (i % 32)
+    DATA_NB_PATTERNS
+} data_pattern_e;
+
+static const char *data_pattern_names[DATA_NB_PATTERNS] = {
+    "RANDOM", "INCREMENT", "ZERO", "ONES", "WALKING_BIT"
+};
+
+// 32-bit LCG (Numerical Recipes parameters), one output word per step
+#define GEN_LCG_A 1664525u
+#define GEN_LCG_C 1013904223u
+
+static uint32_t gen_seed = 1;      // Generator state at the start of the next fill
+
+/**
+ * @brief Advance the generator by one step and return a 32-bit word
+ *
+ * The low bits of a power-of-two modulus LCG have short periods, so the
+ * high half of the state is folded into the output.
+ */
+static inline uint32_t gen_next(uint32_t *state)
+{
+    uint32_t x = *state = GEN_LCG_A * *state + GEN_LCG_C;
+    return x ^ (x >> 16);
+}
+
+/**
+ * @brief Generator state n steps after state, in O(log n)
+ *
+ * n steps of x -> a*x + c are again an affine map; it is built by
+ * repeated squaring of (a, c).
+ */
+static uint32_t gen_jump(uint32_t state, uint32_t n)
+{
+    uint32_t a = GEN_LCG_A, c = GEN_LCG_C;
+    uint32_t acc_a = 1, acc_c = 0;
+
+    while (n)
+    {
+        if (n & 1)
+        {
+            acc_a *= a;
+            acc_c  = acc_c * a + c;
+        }
+        c *= a + 1;
+        a *= a;
+        n >>= 1;
+    }
+    return acc_a * state + acc_c;
+}
+
+/**
+ * @brief Fill words [first, first + nb_words) of buf with a pattern
+ * @param seed Generator state at word 0, so any slice can be filled on its own
+ */
+static void gen_fill(uint32_t *buf, int first, int nb_words, int pattern, uint32_t seed)
+{
+    uint32_t state = gen_jump(seed, first);
+
+    for (int w = first; w < first + nb_words; w++)
+    {
+        switch (pattern)
+        {
+            case DATA_RANDOM:      buf[w] = gen_next(&state); break;
+            case DATA_INCREMENT:   buf[w] = ((4*w) & 0xFF) * 0x01010101u + 0x03020100u; break;
+            case DATA_ZERO:        buf[w] = 0; break;
+            case DATA_ONES:        buf[w] = 0xFFFFFFFFu; break;
+            case DATA_WALKING_BIT: buf[w] = 1u << (w & 31); break;
+        }
+    }
+}
+
+/**
+ * @brief Arguments of the cluster-side fill
+ */
+typedef struct
+{
+    uint32_t *buf;
+    int nb_words;
+    int pattern;
+    uint32_t seed;
+} gen_fill_t;
+
+/**
+ * @brief Fill the calling core's contiguous share of the buffer
+ */
+static void gen_fill_slice(void *arg)
+{
+    gen_fill_t *fill = (gen_fill_t *)arg;
+    int nb_cores = pi_cl_team_nb_cores();
+    int slice    = fill->nb_words / nb_cores;
+    int first    = slice * pi_core_id();
+
+    if (pi_core_id() == nb_cores - 1)
+        slice = fill->nb_words - first;
+
+    gen_fill(fill->buf, first, slice, fill->pattern, fill->seed);
+}
+
+static void gen_fill_entry(void *arg)
+{
+    pi_cl_team_fork(CL_NB_CORES, gen_fill_slice, arg);
+}
+
+/**
+ * @brief Fill size bytes (multiple of 4) of buf and advance the seed
+ *
+ * Consecutive runs get different but reproducible data, whether the
+ * buffer is filled by the FC or split across the cluster cores.
+ */
+static void fill_test_data(char *buf, int size, int pattern)
+{
+    gen_fill_t fill = {(uint32_t *)buf, size / 4, pattern, gen_seed};
+
+    if (DATA_FILL_CLUSTER)
+    {
+        struct pi_cluster_task task;
+        pi_cluster_task(&task, gen_fill_entry, &fill);
+        pi_cluster_send_task_to_cl(&cluster_dev, &task);
+    }
+    else
+        gen_fill(fill.buf, 0, fill.nb_words, pattern, fill.seed);
+
+    gen_seed = gen_jump(gen_seed, fill.nb_words);
+}
+
+/**
+ * @brief fill_test_data() on the FC, whatever DATA_FILL_CLUSTER says
+ *
+ * For fills that overlap a running cluster task: a cluster-side fill would
+ * be a second task sent while the first one is still in flight.
+ */
+static void fill_test_data_fc(char *buf, int size, int pattern)
+{
+    gen_fill((uint32_t *)buf, 0, size / 4, pattern, gen_seed);
+    gen_seed = gen_jump(gen_seed, size / 4);
+}
+
+/*=============================================================================
+ * RESULT VERIFICATION
+ *============================================================================*/
+/**
+ * @brief Multiply each byte of a word by 3 (8-bit wraparound per byte)
+ *
+ * 2*x is a shift with the bit carried into the next byte masked off; the
+ * byte-wise add then keeps carries from crossing byte boundaries by adding
+ * the low 7 bits and patching the top bit in with an XOR.
+ */
+static inline uint32_t swar_mul3(uint32_t w)
+{
+    uint32_t two = (w << 1) & 0xFEFEFEFE;
+    return ((w & 0x7F7F7F7F) + (two & 0x7F7F7F7F)) ^ ((w ^ two) & 0x80808080);
+}
+
+/**
+ * @brief Count a wrong byte in a verification result
+ */
+static inline void verify_mismatch(verify_result_t *res, int index)
+{
+    if (res->first < 0)
+        res->first = index;
+    res->count++;
+}
+
+/**
+ * @brief Check dst[i] == (src[i] * scale) & 0xFF over size bytes
+ * @param scale 3 for the processing pipeline, 1 for plain copies
+ * @param res   First mismatch and total count
+ *
+ * Compares whole words against SWAR-computed expected values and only scans
+ * bytes inside a word that differs. Buffers whose word phase differs are
+ * checked byte by byte.
+ */
+static void verify_scaled(const char *src, const char *dst, int size, int scale,
+                          verify_result_t *res)
+{
+    int i = 0;
+    res->first = -1;
+    res->count = 0;
+
+    if (!(((uint32_t)src ^ (uint32_t)dst) & 3))
+    {
+        // Bytes up to the first word boundary
+        for (; i < size && ((uint32_t)(src + i) & 3); i++)
+            if (dst[i] != (char)(src[i] * scale))
+                verify_mismatch(res, i);
+
+        // Whole words, scanning bytes only inside a differing word
+        for (; i + 4 <= size; i += 4)
+        {
+            uint32_t w = *(const uint32_t *)(src + i);
+            uint32_t expected = scale == 3 ? swar_mul3(w) : w;
+            if (*(const uint32_t *)(dst + i) == expected)
+                continue;
+
+            for (int k = i; k < i + 4; k++)
+                if (dst[k] != (char)(src[k] * scale))
+                    verify_mismatch(res, k);
+        }
+    }
+
+    // Remaining bytes (or everything when the word phases differ)
+    for (; i < size; i++)
+        if (dst[i] != (char)(src[i] * scale))
+            verify_mismatch(res, i);
+}
+
+/**
+ * @brief Add size bytes starting at stream position index to a checksum
+ */
+static void checksum_update(checksum_t *c, const char *data, int size, int index)
+{
+    uint32_t sum = 0, wsum = 0;
+    for (int i = 0; i < size; i++)
+    {
+        uint32_t b = (uint8_t)data[i];
+        sum  += b;
+        wsum += b * (uint32_t)(index + i + 1);
+    }
+    c->sum  += sum;
+    c->wsum += wsum;
+}
+
+/**
+ * @brief Add the expected output (src * 3) of size bytes at stream position index
+ */
+static void checksum_mul3(checksum_t *c, const char *src, int size, int index)
+{
+    uint32_t sum = 0, wsum = 0;
+    for (int i = 0; i < size; i++)
+    {
+        uint32_t b = (uint8_t)(src[i] * 3);
+        sum  += b;
+        wsum += b * (uint32_t)(index + i + 1);
+    }
+    c->sum  += sum;
+    c->wsum += wsum;
+}
+
+/*=============================================================================
+ * L1 LAYOUT
+ *============================================================================*/
+/**
+ * @brief Distance between two consecutive tiles in L1
+ * @return Stride in bytes, or 0 for the contiguous layout
+ *
+ * The interleaved layout rounds every tile up to a full row of banks and
+ * then skews it by TCDM_NB_BANKS/nb_cores banks, so the tiles that the cores
+ * process at the same time start in different banks instead of all hitting
+ * bank 0 in lockstep.
+ */
+static int l1_tile_stride(const dma_test_t *test)
+{
+    if (test->layout != L1_LAYOUT_INTERLEAVED)
+        return 0;
+
+    int copy_size = test->size / test->nb_iter / test->nb_copy;
+    int iter_size = test->size / test->nb_iter;
+    int max_len   = test->size - iter_size*(test->nb_iter - 1) - copy_size*(test->nb_copy - 1);
+    int row       = TCDM_NB_BANKS * TCDM_BANK_WIDTH;
+    int cores     = test->nb_cores > 1 ? test->nb_cores : 1;
+    int skew      = TCDM_NB_BANKS / cores > 0 ? TCDM_NB_BANKS / cores : 1;
+
+    return (max_len + row - 1) / row * row + skew * TCDM_BANK_WIDTH;
+}
+
+/**
+ * @brief L1 bytes needed by a test for its tiles
+ */
+static int l1_footprint(const dma_test_t *test)
+{
+    int stride = l1_tile_stride(test);
+    return stride ? stride * test->nb_copy * test->nb_iter : test->size;
+}
+
+/**
+ * @brief L1 address of chunk i of iteration j
+ */
+static inline char *l1_tile(const dma_test_t *test, int copy_size, int iter_size, int i, int j)
+{
+    if (test->tile_stride)
+        return test->loc + test->tile_stride * (j*test->nb_copy + i);
+    return test->loc + copy_size*i + iter_size*j;
+}
+
+/**
+ * @brief Length of chunk i of iteration j (remainders go to the last ones)
+ */
+static inline int chunk_len(const dma_test_t *test, int copy_size, int iter_size, int i, int j)
+{
+    int iter_len = (j == test->nb_iter - 1) ? test->size - iter_size*j : iter_size;
+    return (i == test->nb_copy - 1) ? iter_len - copy_size*(test->nb_copy - 1) : copy_size;
+}
+
+/*=============================================================================
+ * TRANSFER WRAPPER
+ *============================================================================*/
+/**
+ * @brief Linear cost model used to decide whether splitting pays off
+ *
+ * Per-byte costs are Q8 fixed point so the cluster does not need floats.
+ * They start from the DMA_MODEL_* values and are refitted on the target by
+ * dma_model_calibrate(); the fixed split overhead is never measured.
+ */
+typedef struct
+{
+    uint32_t split_cycles;      // Fixed core overhead of splitting a chunk (head/tail copies)
+    uint32_t aligned_cpb;       // DMA cycles/byte (Q8), both ends word aligned
+    uint32_t misaligned_cpb;    // DMA cycles/byte (Q8), either end misaligned
+    uint32_t core_cpb;          // Core byte copy cycles/byte (Q8)
+} dma_model_t;
+
+static dma_model_t dma_model = {
+    DMA_MODEL_SPLIT_CYCLES, DMA_MODEL_ALIGNED_CPB,
+    DMA_MODEL_MISALIGNED_CPB, DMA_MODEL_CORE_CPB
+};
+
+/**
+ * @brief Byte copy performed by the calling core
+ */
+static inline void core_copy(char *dst, const char *src, int size)
+{
+    for (int i = 0; i < size; i++)
+        dst[i] = src[i];
+}
+
+/**
+ * @brief Copy performed by the calling core with the given XFER_CPU_* policy
+ *
+ * Word variants first align the destination with byte copies; when source
+ * and destination differ in word phase they fall back to bytes. The
+ * unrolled variant issues four loads before its four stores so the L2
+ * latency of consecutive loads overlaps.
+ */
+static void cpu_copy(char *dst, const char *src, int size, int policy)
+{
+    if (policy != XFER_CPU_BYTE && !(((uint32_t)dst ^ (uint32_t)src) & 3))
+    {
+        while (((uint32_t)dst & 3) && size)
+        {
+            *dst++ = *src++;
+            size--;
+        }
+
+        uint32_t *d = (uint32_t *)dst;
+        const uint32_t *s = (const uint32_t *)src;
+        int words = size >> 2;
+
+        if (policy == XFER_CPU_UNROLL)
+        {
+            for (; words >= 4; words -= 4, d += 4, s += 4)
+            {
+                uint32_t w0 = s[0], w1 = s[1], w2 = s[2], w3 = s[3];
+                d[0] = w0; d[1] = w1; d[2] = w2; d[3] = w3;
+            }
+        }
+        for (; words > 0; words--)
+            *d++ = *s++;
+
+        dst = (char *)d;
+        src = (const char *)s;
+        size &= 3;
+    }
+
+    core_copy(dst, src, size);
+}
+
+/**
+ * @brief Issue a contiguous transfer through the MCHAN HAL
+ * @param ext  Address in L2
+ * @param loc  Address in L1
+ * @param size Bytes to move, 1..DMA_HAL_MAX_SIZE
+ * @param dir  PI_CL_DMA_DIR_EXT2LOC or PI_CL_DMA_DIR_LOC2EXT
+ * @return Counter id to pass to dma_hal_wait()
+ *
+ * plp_dma_memcpy() is the HAL call the PMSIS driver makes underneath; going
+ * to it directly only skips the pi_cl_dma_cmd_t bookkeeping of the driver.
+ * Both paths take their counters from the same pool, so HAL-path and PMSIS
+ * commands may be in flight together. No 2D, event or size checks: callers
+ * keep to contiguous chunks below 64 KiB.
+ */
+static inline int dma_hal_memcpy(uint32_t ext, uint32_t loc, int size, pi_cl_dma_dir_e dir)
+{
+    return plp_dma_memcpy(ext, loc, size, dir == PI_CL_DMA_DIR_EXT2LOC ? PLP_DMA_EXT2LOC
+                                                                       : PLP_DMA_LOC2EXT);
+}
+
+/**
+ * @brief Wait for a HAL-path transfer and release its counter
+ */
+static inline void dma_hal_wait(int id)
+{
+    plp_dma_wait(id);
+}
+
+/**
+ * @brief Move one chunk between L2 and L1 according to the transfer policy
+ * @param ext    Address in L2
+ * @param loc    Address in L1
+ * @param size   Bytes to move
+ * @param dir    PI_CL_DMA_DIR_EXT2LOC or PI_CL_DMA_DIR_LOC2EXT
+ * @param policy Transfer policy (xfer_policy_e)
+ * @param xfer   Handle to pass to dma_xfer_wait()
+ *
+ * With XFER_SPLIT, a chunk whose L2 and L1 addresses share the same word
+ * phase is cut into an unaligned head and tail copied by the core and a
+ * word-aligned body moved by the DMA. The split is only taken when the cost
+ * model predicts it to be cheaper than a single misaligned DMA command.
+ * Chunks whose addresses differ in phase cannot be aligned at both ends and
+ * always use a single command.
+ *
+ * XFER_CPU_* policies copy the chunk with the calling core before returning.
+ * XFER_HYBRID does the same with the calibrated variant for chunks below
+ * the calibrated threshold and uses a DMA command otherwise.
+ *
+ * XFER_HAL issues chunks up to DMA_HAL_MAX_SIZE through dma_hal_memcpy()
+ * and larger ones through pi_cl_dma_cmd.
+ */
+static void dma_xfer(uint32_t ext, uint32_t loc, int size, pi_cl_dma_dir_e dir,
+                     int policy, dma_xfer_t *xfer)
+{
+    int head = 0, tail = 0;
+
+    if (policy == XFER_HYBRID)
+        policy = size < xfer_calib.cpu_threshold ? xfer_calib.cpu_policy : XFER_DMA;
+
+    if (XFER_IS_CPU(policy))
+    {
+        if (dir == PI_CL_DMA_DIR_EXT2LOC)
+            cpu_copy((char *)loc, (const char *)ext, size, policy);
+        else
+            cpu_copy((char *)ext, (const char *)loc, size, policy);
+        xfer->pending = XFER_PENDING_NONE;
+        xfer->dma_bytes = 0;
+        return;
+    }
+
+    if (policy == XFER_HAL && size <= DMA_HAL_MAX_SIZE)
+    {
+        xfer->hal_id = dma_hal_memcpy(ext, loc, size, dir);
+        xfer->pending = XFER_PENDING_HAL;
+        xfer->dma_bytes = size;
+        return;
+    }
+
+    if (policy == XFER_SPLIT && ((ext | loc | size) & 3) && !((ext ^ loc) & 3))
+    {
+        int h = (4 - (ext & 3)) & 3;
+        int body = (size - h) & ~3;
+        uint32_t dma_cost   = size * dma_model.misaligned_cpb;
+        uint32_t split_cost = body * dma_model.aligned_cpb + (size - body) * dma_model.core_cpb +
+                              (dma_model.split_cycles << 8);
+
+        if (body > 0 && split_cost < dma_cost)
+        {
+            head = h;
+            tail = size - h - body;
+        }
+    }
+
+    if (head || tail)
+    {
+        char *e = (char *)ext, *l = (char *)loc;
+        int body = size - head - tail;
+
+        if (dir == PI_CL_DMA_DIR_EXT2LOC)
+        {
+            core_copy(l, e, head);
+            core_copy(l + head + body, e + head + body, tail);
+        }
+        else
+        {
+            core_copy(e, l, head);
+            core_copy(e + head + body, l + head + body, tail);
+        }
+        ext += head;
+        loc += head;
+        size = body;
+    }
+
+    pi_cl_dma_cmd(ext, loc, size, dir, &xfer->cmd);
+    xfer->pending = XFER_PENDING_PMSIS;
+    xfer->dma_bytes = size;
+}
+
+/**
+ * @brief Wait for a transfer issued through dma_xfer()
+ */
+static inline void dma_xfer_wait(dma_xfer_t *xfer)
+{
+    if (xfer->pending == XFER_PENDING_HAL)
+        dma_hal_wait(xfer->hal_id);
+    else if (xfer->pending == XFER_PENDING_PMSIS)
+        pi_cl_dma_cmd_wait(&xfer->cmd);
+    xfer->pending = XFER_PENDING_NONE;
+}
+
+/*=============================================================================
+ * CLUSTER PERFORMANCE COUNTERS
+ *============================================================================*/
+/**
+ * @brief Start the counter profile on the calling core (forked on the team)
+ */
+static void perf_profile_start(void *arg)
+{
+    pi_perf_conf(PERF_PROFILE_EVENTS);
+    pi_perf_reset();
+    pi_perf_start();
+}
+
+/**
+ * @brief Stop the counter profile and store it (forked on the team)
+ */
+static void perf_profile_stop(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+    cl_perf_t *perf = &test->perf[pi_core_id()];
+
+    pi_perf_stop();
+    perf->cycles    = pi_perf_read(PI_PERF_CYCLES);
+    perf->active    = pi_perf_read(PI_PERF_ACTIVE_CYCLES);
+    perf->instr     = pi_perf_read(PI_PERF_INSTR);
+    perf->ld_stall  = pi_perf_read(PI_PERF_LD_STALL);
+    perf->tcdm_cont = pi_perf_read(PI_PERF_TCDM_CONT);
+    perf->imiss     = pi_perf_read(PI_PERF_IMISS);
+}
+
+/*=============================================================================
+ * EVENT TRACE
+ *============================================================================*/
+/**
+ * @brief Record an event in the calling core's ring
+ *
+ * Timestamps come from the core's cycle counter, which the profile started
+ * on every core at the beginning of the task, so cores differ by a few
+ * cycles at most. Only the newest ring->depth events of a core are kept.
+ */
+static inline void trace_event(const dma_test_t *test, int event, int tile, int cmd)
+{
+    if (!test->rings || pi_core_id() >= CL_NB_CORES)
+        return;
+
+    trace_ring_t *ring = &test->rings[pi_core_id()];
+    if (!ring->depth)
+    {
+        ring->count++;
+        return;
+    }
+    trace_record_t *rec = &ring->ev[ring->count++ % ring->depth];
+    rec->ts    = pi_perf_read(PI_PERF_CYCLES);
+    rec->core  = pi_core_id();
+    rec->event = event;
+    rec->tile  = tile;
+    rec->cmd   = cmd;
+}
+
+/**
+ * @brief Print the rings of a finished run, oldest event first per core
+ *
+ * The TRACE_BEGIN/TRACE/TRACE_END lines are turned into a Chrome trace or
+ * a VCD file by tools/trace2chrome.py.
+ */
+static void trace_dump(const dma_test_t *test)
+{
+    printf("TRACE_BEGIN NB_COPY=%d NB_ITER=%d Size=%d Policy=%s Cores=%d\n",
+           test->nb_copy, test->nb_iter, test->size, xfer_policy_names[test->policy],
+           test->nb_cores > 1 ? test->nb_cores : 1);
+
+    for (int c = 0; c < CL_NB_CORES; c++)
+    {
+        const trace_ring_t *ring = &test->rings[c];
+        uint32_t first = ring->count > ring->depth ? ring->count - ring->depth : 0;
+
+        if (first)
+            printf("TRACE_LOST core=%d events=%u\n", c, first);
+        for (uint32_t n = first; n < ring->count; n++)
+        {
+            const trace_record_t *rec = &ring->ev[n % ring->depth];
+            printf("TRACE %u %u %s %u %u\n", rec->core, rec->ts,
+                   trace_event_names[rec->event], rec->tile, rec->cmd);
+        }
+    }
+    printf("TRACE_END\n");
+}
+
+/**
+ * @brief Take the event rings of a run from the L1 arena
+ * @return CL_NB_CORES rings, NULL if not even the ring headers fit
+ *
+ * Rings are sized from the events the run records: the master issues and
+ * waits for every chunk in both directions (4 per tile) and records its
+ * processing events; with team processing, the other cores only record
+ * theirs. Each depth is capped by TRACE_DEPTH, and all of them are scaled
+ * down together when the arena has less room left; the rings then keep the
+ * newest events and trace_dump() reports the lost ones.
+ */
+static trace_ring_t *trace_alloc(const dma_test_t *test)
+{
+    trace_ring_t *rings = l1_arena_alloc(CL_NB_CORES * sizeof(trace_ring_t), 4);
+    if (!rings)
+        return NULL;
+
+    uint32_t iters = test->nb_iter;
+    uint32_t tiles = test->nb_copy * iters;
+    int team  = test->schedule != SCHED_INTERLEAVED && (test->nb_cores > 1 || l1_tile_stride(test));
+    int cores = team && test->nb_cores > 1 ? test->nb_cores : 1;
+
+    // Processing events of one team core: its share of the tiles processed per iteration
+    uint32_t iter_tiles = test->iter_proc ? (uint32_t)test->nb_copy : tiles;
+    uint32_t others = team ? 2 * iters * ((iter_tiles + cores - 1) / cores) : 0;
+    // Single-core processing records one tile per chunk (interleaved) or per iteration
+    uint32_t master = 4 * tiles + (team ? others : 2 * (tiles > iters ? tiles : iters));
+
+    if (master > TRACE_DEPTH)
+        master = TRACE_DEPTH;
+    if (others > TRACE_DEPTH)
+        others = TRACE_DEPTH;
+
+    // One record of slack per ring for the alignment of its allocation
+    uint32_t need  = master + (cores - 1) * others + cores;
+    uint32_t avail = (l1_arena.size - l1_arena.top) / sizeof(trace_record_t);
+    if (need > avail)
+    {
+        master = master * avail / need;
+        others = others * avail / need;
+    }
+
+    for (int c = 0; c < CL_NB_CORES; c++)
+    {
+        rings[c].count = 0;
+        rings[c].depth = c == 0 ? master : c < cores ? others : 0;
+        rings[c].ev = rings[c].depth ? l1_arena_alloc(rings[c].depth * sizeof(trace_record_t), 4) : NULL;
+        if (!rings[c].ev)
+            rings[c].depth = 0;
+    }
+    return rings;
+}
+
+/*=============================================================================
+ * CLUSTER PROCESSING FUNCTION
+ *============================================================================*/
+/**
+ * @brief Multiply every tile by 3, tiles distributed round-robin over the team
+ * @param arg Pointer to the dma_test_t describing this run
+ *
+ * Runs on every forked core. Like the single-core loop, it processes the
+ * whole buffer, or only the tiles of test->cur_iter with iter_proc, and it
+ * records the cycles and TCDM contention stalls that the calling core
+ * spends doing so. When the task is profiled the counters
+ * are already running and only deltas are taken.
+ */
+static void process_tiles(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+    int core     = pi_core_id();
+    int nb_cores = pi_cl_team_nb_cores();
+
+    int COPY_SIZE = test->size / test->nb_iter / test->nb_copy;
+    int ITER_SIZE = test->size / test->nb_iter;
+    int first     = test->iter_proc ? test->cur_iter * test->nb_copy : 0;
+    int last      = test->iter_proc ? first + test->nb_copy : test->nb_copy * test->nb_iter;
+
+    if (!test->profile)
+    {
+        pi_perf_conf((1 << PI_PERF_CYCLES) | (1 << PI_PERF_TCDM_CONT));
+        pi_perf_reset();
+        pi_perf_start();
+    }
+    uint32_t cycles    = pi_perf_read(PI_PERF_CYCLES);
+    uint32_t tcdm_cont = pi_perf_read(PI_PERF_TCDM_CONT);
+
+    for (int t = first + core; t < last; t += nb_cores)
+    {
+        int i = t % test->nb_copy;
+        int j = t / test->nb_copy;
+        int len = chunk_len(test, COPY_SIZE, ITER_SIZE, i, j);
+        char *tile = l1_tile(test, COPY_SIZE, ITER_SIZE, i, j);
+
+        trace_event(test, TR_PROC_START, t, 0);
+        for (int k = 0; k < len; k++)
+            tile[k] = tile[k] * 3;
+        trace_event(test, TR_PROC_END, t, 0);
+    }
+
+    test->proc_cycles[core] += pi_perf_read(PI_PERF_CYCLES) - cycles;
+    test->tcdm_cont[core]   += pi_perf_read(PI_PERF_TCDM_CONT) - tcdm_cont;
+    if (!test->profile)
+        pi_perf_stop();
+}
+
+/**
+ * @brief Arguments of cpu_copy_phase()
+ */
+typedef struct
+{
+    dma_test_t *test;
+    int iter;           // Iteration whose chunks are copied
+    int dir;            // PI_CL_DMA_DIR_EXT2LOC or PI_CL_DMA_DIR_LOC2EXT
+} cpu_copy_phase_t;
+
+/**
+ * @brief Copy all chunks of one iteration with the whole team
+ * @param arg Pointer to a cpu_copy_phase_t
+ *
+ * Every chunk is cut into one word-aligned slice per core, the last core
+ * taking the remainder.
+ */
+static void cpu_copy_phase(void *arg)
+{
+    cpu_copy_phase_t *phase = (cpu_copy_phase_t *)arg;
+    dma_test_t *test = phase->test;
+    int core     = pi_core_id();
+    int nb_cores = pi_cl_team_nb_cores();
+    int j        = phase->iter;
+
+    int COPY_SIZE = test->size / test->nb_iter / test->nb_copy;
+    int ITER_SIZE = test->size / test->nb_iter;
+
+    for (int i = 0; i < test->nb_copy; i++)
+    {
+        int len   = chunk_len(test, COPY_SIZE, ITER_SIZE, i, j);
+        int slice = (len / nb_cores) & ~3;
+        int start = slice * core;
+        int count = (core == nb_cores - 1) ? len - start : slice;
+        char *tile = l1_tile(test, COPY_SIZE, ITER_SIZE, i, j) + start;
+
+        if (phase->dir == PI_CL_DMA_DIR_EXT2LOC)
+            cpu_copy(tile, test->src + COPY_SIZE*i + ITER_SIZE*j + start, count, test->policy);
+        else
+            cpu_copy(test->dst + COPY_SIZE*i + ITER_SIZE*j + start, tile, count, test->policy);
+    }
+}
+
+/**
+ * @brief Arguments of checksum_tiles()
+ */
+typedef struct
+{
+    dma_test_t *test;
+    int iter;           // Iteration whose tiles are checksummed
+} checksum_phase_t;
+
+/**
+ * @brief Checksum the calling core's share of one iteration's tiles
+ * @param arg Pointer to a checksum_phase_t
+ *
+ * The iteration is cut into one word-aligned slice per core, the last core
+ * taking the remainder; a slice may span several tiles. Each core adds to
+ * its own partial checksum, verify_dma_test() sums the partials.
+ */
+static void checksum_tiles(void *arg)
+{
+    checksum_phase_t *phase = (checksum_phase_t *)arg;
+    dma_test_t *test = phase->test;
+    int core     = pi_core_id();
+    int nb_cores = pi_cl_team_nb_cores();
+    int j        = phase->iter;
+
+    int COPY_SIZE = test->size / test->nb_iter / test->nb_copy;
+    int ITER_SIZE = test->size / test->nb_iter;
+
+    int iter_len = (j == test->nb_iter - 1) ? test->size - ITER_SIZE*j : ITER_SIZE;
+    int slice    = (iter_len / nb_cores) & ~3;
+    int start    = slice * core;
+    int end      = (core == nb_cores - 1) ? iter_len : start + slice;
+
+    for (int i = 0; i < test->nb_copy; i++)
+    {
+        // Chunk i covers [first, first + len) of the iteration
+        int first = COPY_SIZE*i;
+        int len   = chunk_len(test, COPY_SIZE, ITER_SIZE, i, j);
+        int lo    = start > first ? start : first;
+        int hi    = end < first + len ? end : first + len;
+
+        if (lo < hi)
+            checksum_update(&test->core_checksum[core],
+                            l1_tile(test, COPY_SIZE, ITER_SIZE, i, j) + lo - first,
+                            hi - lo, ITER_SIZE*j + lo);
+    }
+}
+
+/**
+ * @brief Checksum the processed tiles of iteration j with the whole team
+ */
+static inline void checksum_iteration(dma_test_t *test, int j)
+{
+    checksum_phase_t phase = {test, j};
+    pi_cl_team_fork(CL_NB_CORES, checksum_tiles, &phase);
+}
+
+/**
+ * @brief One iteration of the interleaved schedule on the master core
+ * @param t0 Master cycle counter at the start of the iteration (profiled runs)
+ * @return Master cycle counter at the end of the iteration (profiled runs)
+ *
+ * The read of chunk i+1 is issued before chunk i is waited for and
+ * processed, and the write-back of chunk i is issued right after, so the
+ * DMA has a read and a write in flight at the same time. Each chunk is
+ * processed once, by the master; the writes are waited for at the end of
+ * the iteration. Waiting for reads counts as the read phase, the write
+ * issues and the final waits as the write phase.
+ */
+static uint32_t interleave_iteration(dma_test_t *test, int j, uint32_t t0)
+{
+    int NB_COPY   = test->nb_copy;
+    int COPY_SIZE = test->size / test->nb_iter / NB_COPY;
+    int ITER_SIZE = test->size / test->nb_iter;
+    int L1_STEP   = test->tile_stride ? test->tile_stride : COPY_SIZE;
+    dma_xfer_t *copy = test->xfers;    // copy[i] carries the read, then the write of chunk i
+    uint32_t t1;
+
+    // Remainders go to the last iteration and to its last chunk
+    int iter_len = (j == test->nb_iter - 1) ? test->size - ITER_SIZE*j : ITER_SIZE;
+    int last_len = iter_len - COPY_SIZE*(NB_COPY - 1);
+
+    // Addresses are stepped per chunk like in cluster_entry; reads run one chunk ahead
+    uint32_t rd_ext = (uint32_t)test->src + ITER_SIZE*j;   // L2 source of the next read
+    uint32_t wr_ext = (uint32_t)test->dst + ITER_SIZE*j;   // L2 destination of chunk i
+    uint32_t l1     = (uint32_t)l1_tile(test, COPY_SIZE, ITER_SIZE, 0, j);
+
+    dma_xfer(rd_ext, l1, NB_COPY == 1 ? last_len : COPY_SIZE,
+             PI_CL_DMA_DIR_EXT2LOC, test->policy, &copy[0]);
+    trace_event(test, TR_READ_ISSUE, j*NB_COPY, 2*j*NB_COPY);
+
+    for (int i = 0; i < NB_COPY; i++, wr_ext += COPY_SIZE, l1 += L1_STEP)
+    {
+        char *tile = (char *)l1;
+        int len = i == NB_COPY - 1 ? last_len : COPY_SIZE;
+
+        // Prefetch the next chunk while this one completes
+        if (i + 1 < NB_COPY)
+        {
+            rd_ext += COPY_SIZE;
+            dma_xfer(rd_ext, l1 + L1_STEP, i + 1 == NB_COPY - 1 ? last_len : COPY_SIZE,
+                     PI_CL_DMA_DIR_EXT2LOC, test->policy, &copy[i + 1]);
+            trace_event(test, TR_READ_ISSUE, j*NB_COPY + i + 1, 2*j*NB_COPY + i + 1);
+        }
+
+        dma_xfer_wait(&copy[i]);
+        test->dma_bytes += copy[i].dma_bytes;
+        trace_event(test, TR_READ_DONE, j*NB_COPY + i, 2*j*NB_COPY + i);
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[0] += t1 - t0;
+            t0 = t1;
+        }
+
+        trace_event(test, TR_PROC_START, j*NB_COPY + i, 0);
+        for (int k = 0; k < len; k++)
+            tile[k] = tile[k] * 3;
+        trace_event(test, TR_PROC_END, j*NB_COPY + i, 0);
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[1] += t1 - t0;
+            t0 = t1;
+        }
+
+        dma_xfer(wr_ext, l1, len, PI_CL_DMA_DIR_LOC2EXT, test->policy, &copy[i]);
+        trace_event(test, TR_WRITE_ISSUE, j*NB_COPY + i, (2*j + 1)*NB_COPY + i);
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[2] += t1 - t0;
+            t0 = t1;
+        }
+    }
+
+    // The tiles of this iteration are final; checksum them while the
+    // last write-backs drain
+    if (test->verify_mode == VERIFY_CHECKSUM)
+        checksum_iteration(test, j);
+
+    for (int i = 0; i < NB_COPY; i++)
+    {
+        dma_xfer_wait(&copy[i]);
+        test->dma_bytes += copy[i].dma_bytes;
+        trace_event(test, TR_WRITE_DONE, j*NB_COPY + i, (2*j + 1)*NB_COPY + i);
+    }
+    if (test->profile)
+    {
+        t1 = pi_perf_read(PI_PERF_CYCLES);
+        test->phase_cycles[2] += t1 - t0;
+        t0 = t1;
+    }
+
+    return t0;
+}
+
+/**
+ * @brief Issue the chunks of iteration j in one direction (phased schedule)
+ * @param ext      L2 address of the first chunk
+ * @param l1       L1 address of the first chunk
+ * @param last_len Length of the last chunk (remainder included)
+ *
+ * Untraced XFER_DMA and XFER_HAL runs resolve the policy once and push the
+ * commands from a counted-down loop with stepped addresses and no call to
+ * dma_xfer(), the form measured by ISSUE_BENCH. Other policies and traced
+ * runs go through dma_xfer() chunk by chunk.
+ */
+static void issue_iteration(dma_test_t *test, int j, uint32_t ext, uint32_t l1, int last_len,
+                            pi_cl_dma_dir_e dir)
+{
+    int NB_COPY   = test->nb_copy;
+    int COPY_SIZE = test->size / test->nb_iter / NB_COPY;
+    int L1_STEP   = test->tile_stride ? test->tile_stride : COPY_SIZE;
+    dma_xfer_t *x = test->xfers;
+
+    if (!test->rings && test->policy == XFER_HAL && last_len <= DMA_HAL_MAX_SIZE)
+    {
+        for (int n = NB_COPY; n > 0; n--, x++, ext += COPY_SIZE, l1 += L1_STEP)
+        {
+            x->dma_bytes = n == 1 ? last_len : COPY_SIZE;
+            x->hal_id    = dma_hal_memcpy(ext, l1, x->dma_bytes, dir);
+            x->pending   = XFER_PENDING_HAL;
+        }
+    }
+    else if (!test->rings && test->policy == XFER_DMA)
+    {
+        for (int n = NB_COPY; n > 0; n--, x++, ext += COPY_SIZE, l1 += L1_STEP)
+        {
+            x->dma_bytes = n == 1 ? last_len : COPY_SIZE;
+            pi_cl_dma_cmd(ext, l1, x->dma_bytes, dir, &x->cmd);
+            x->pending   = XFER_PENDING_PMSIS;
+        }
+    }
+    else
+    {
+        // Command ids: reads of iteration j, then its writes
+        int event = dir == PI_CL_DMA_DIR_EXT2LOC ? TR_READ_ISSUE : TR_WRITE_ISSUE;
+        int cmd   = (dir == PI_CL_DMA_DIR_EXT2LOC ? 2*j : 2*j + 1) * NB_COPY;
+
+        for (int i = 0; i < NB_COPY; i++, ext += COPY_SIZE, l1 += L1_STEP)
+        {
+            dma_xfer(ext, l1, i == NB_COPY - 1 ? last_len : COPY_SIZE, dir, test->policy, &x[i]);
+            trace_event(test, event, j*NB_COPY + i, cmd + i);
+        }
+    }
+}
+
+/**
+ * @brief Main cluster task that performs parameterized DMA transfers
+ * @param arg Pointer to the dma_test_t describing this run
+ * 
+ * This function runs on the cluster and performs:
+ * 1. Chunked DMA transfers from L2 to L1 (EXT2LOC)
+ * 2. Simple data processing (multiply by 3) 
+ * 3. Chunked DMA transfers from L1 back to L2 (LOC2EXT)
+ * 
+ * The chunking parameters control DMA granularity:
+ * - NB_COPY: Number of DMA commands issued per iteration
+ * - NB_ITER: Number of iterations to process entire buffer
+ * - COPY_SIZE: Bytes transferred per DMA command
+ *
+ * When the size does not divide evenly, the last chunk of an iteration and
+ * the last iteration absorb the remainder.
+ *
+ * The phased schedule issues each direction through issue_iteration();
+ * SCHED_INTERLEAVED runs each iteration through interleave_iteration().
+ */
+static void cluster_entry(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+
+    // Extract DMA parameters from argument
+    int NB_COPY  = test->nb_copy;    // Number of DMA copies per iteration
+    int NB_ITER  = test->nb_iter;    // Number of iterations to complete buffer
+    int SIZE     = test->size;       // Total bytes to move
+    
+    // Calculate chunk sizes based on parameters
+    int COPY_SIZE = SIZE / NB_ITER / NB_COPY;  // Bytes per individual DMA transfer
+    int ITER_SIZE = SIZE / NB_ITER;            // Bytes processed per iteration
+
+    char *src = test->src;
+    char *dst = test->dst;
+
+    if (test->rings)
+        for (int c = 0; c < CL_NB_CORES; c++)
+            test->rings[c].count = 0;
+
+    // Counters of every core cover the whole task, including idle slaves
+    if (test->profile)
+        pi_cl_team_fork(CL_NB_CORES, perf_profile_start, test);
+
+    // Phase boundaries are read from the master's running cycle counter
+    uint32_t t0 = test->profile ? pi_perf_read(PI_PERF_CYCLES) : 0, t1;
+
+    // Process buffer across multiple iterations
+    for (int j = 0; j < NB_ITER; j++)
+    {
+        if (test->schedule == SCHED_INTERLEAVED)
+        {
+            t0 = interleave_iteration(test, j, t0);
+            continue;
+        }
+
+        dma_xfer_t *copy = test->xfers; // Transfer handles for this iteration (L1 arena)
+
+        // Remainders go to the last iteration and to its last chunk
+        int iter_len = (j == NB_ITER - 1) ? SIZE - ITER_SIZE*j : ITER_SIZE;
+        int last_len = iter_len - COPY_SIZE*(NB_COPY - 1);
+
+        // Issue loops step both addresses instead of recomputing them per chunk
+        uint32_t l1_base = (uint32_t)l1_tile(test, COPY_SIZE, ITER_SIZE, 0, j);
+
+        /*---------------------------------------------------------------------
+         * PHASE 1: Transfer data from L2 to L1 (EXT2LOC)
+         *--------------------------------------------------------------------*/
+        if (test->copy_cores > 1)
+        {
+            // CPU-driven copy shared by the team
+            cpu_copy_phase_t phase = {test, j, PI_CL_DMA_DIR_EXT2LOC};
+            pi_cl_team_fork(test->copy_cores, cpu_copy_phase, &phase);
+        }
+        else
+        {
+            // Issue all DMA read commands for this iteration
+            issue_iteration(test, j, (uint32_t)src + ITER_SIZE*j, l1_base, last_len,
+                            PI_CL_DMA_DIR_EXT2LOC);
+
+            // Wait for all EXT2LOC transfers to complete before processing
+            for (int i = 0; i < NB_COPY; i++)
+            {
+                dma_xfer_wait(&copy[i]);
+                test->dma_bytes += copy[i].dma_bytes;
+                trace_event(test, TR_READ_DONE, j*NB_COPY + i, 2*j*NB_COPY + i);
+            }
+        }
+
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[0] += t1 - t0;
+            t0 = t1;
+        }
+
+        /*---------------------------------------------------------------------
+         * PHASE 2: Process data in fast L1 memory
+         *--------------------------------------------------------------------*/
+        // Optional processing: multiply each byte by 3 for verification
+        // This runs efficiently in L1 memory with low access latency
+        if (test->nb_cores > 1 || test->tile_stride)
+        {
+            // Tiled processing shared by the team
+            test->cur_iter = j;
+            pi_cl_team_fork(test->nb_cores > 1 ? test->nb_cores : 1, process_tiles, test);
+        }
+        else
+        {
+            // Contiguous tiles: the iteration's tiles are one block at l1_base
+            char *loc = test->iter_proc ? (char *)l1_base : test->loc;
+            int len   = test->iter_proc ? iter_len : SIZE;
+            trace_event(test, TR_PROC_START, TRACE_ALL_TILES, 0);
+            for (int i = 0; i < len; i++)
+                loc[i] = loc[i] * 3;
+            trace_event(test, TR_PROC_END, TRACE_ALL_TILES, 0);
+        }
+
+        // Running checksum of the tiles about to leave L1
+        if (test->verify_mode == VERIFY_CHECKSUM)
+            checksum_iteration(test, j);
+
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[1] += t1 - t0;
+            t0 = t1;
+        }
+
+        /*---------------------------------------------------------------------
+         * PHASE 3: Transfer processed data from L1 back to L2 (LOC2EXT)
+         *--------------------------------------------------------------------*/
+        if (test->copy_cores > 1)
+        {
+            // CPU-driven copy shared by the team
+            cpu_copy_phase_t phase = {test, j, PI_CL_DMA_DIR_LOC2EXT};
+            pi_cl_team_fork(test->copy_cores, cpu_copy_phase, &phase);
+        }
+        else
+        {
+            // Write back: Issue all DMA write commands for this iteration
+            issue_iteration(test, j, (uint32_t)dst + ITER_SIZE*j, l1_base, last_len,
+                            PI_CL_DMA_DIR_LOC2EXT);
+
+            // Wait for all LOC2EXT transfers to complete before next iteration
+            for (int i = 0; i < NB_COPY; i++)
+            {
+                dma_xfer_wait(&copy[i]);
+                test->dma_bytes += copy[i].dma_bytes;
+                trace_event(test, TR_WRITE_DONE, j*NB_COPY + i, (2*j + 1)*NB_COPY + i);
+            }
+        }
+
+        if (test->profile)
+        {
+            t1 = pi_perf_read(PI_PERF_CYCLES);
+            test->phase_cycles[2] += t1 - t0;
+            t0 = t1;
+        }
+    }
+
+    if (test->profile)
+        pi_cl_team_fork(CL_NB_CORES, perf_profile_stop, test);
+}
+
+/*=============================================================================
+ * CLUSTER VERIFICATION
+ *============================================================================*/
+/**
+ * @brief Verify one slice of the output on the calling core
+ * @param arg Pointer to the dma_test_t describing the run
+ *
+ * Each core takes a contiguous, word-aligned share of the buffer and DMAs
+ * matching reference and result tiles into its own L1 scratch, where both
+ * are word aligned so verify_scaled() always takes its word path.
+ */
+static void verify_slice(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+    int core     = pi_core_id();
+    int nb_cores = pi_cl_team_nb_cores();
+    int slice    = (test->size / nb_cores) & ~3;
+    int start    = slice * core;
+    int end      = (core == nb_cores - 1) ? test->size : start + slice;
+
+    char *ref = test->verify_scratch + 2*VERIFY_TILE*core;
+    char *out = ref + VERIFY_TILE;
+    verify_result_t *res = &test->core_verify[core];
+    verify_result_t tile_res;
+    pi_cl_dma_cmd_t cmd_ref, cmd_out;
+
+    res->first = -1;
+    res->count = 0;
+
+    for (int off = start; off < end; off += VERIFY_TILE)
+    {
+        int len = end - off < VERIFY_TILE ? end - off : VERIFY_TILE;
+
+        pi_cl_dma_cmd((uint32_t)test->src + off, (uint32_t)ref, len, PI_CL_DMA_DIR_EXT2LOC, &cmd_ref);
+        pi_cl_dma_cmd((uint32_t)test->dst + off, (uint32_t)out, len, PI_CL_DMA_DIR_EXT2LOC, &cmd_out);
+        pi_cl_dma_cmd_wait(&cmd_ref);
+        pi_cl_dma_cmd_wait(&cmd_out);
+
+        verify_scaled(ref, out, len, 3, &tile_res);
+        if (tile_res.count && res->first < 0)
+            res->first = off + tile_res.first;
+        res->count += tile_res.count;
+    }
+}
+
+/**
+ * @brief Second cluster task: verification split across the team
+ */
+static void verify_entry(void *arg)
+{
+    pi_cl_team_fork(CL_NB_CORES, verify_slice, arg);
+}
+
+/**
+ * @brief Checksum one slice of the source and of the output on the calling core
+ * @param arg Pointer to the dma_test_t describing the run
+ *
+ * Same slices and L1 scratch tiles as verify_slice(); the core adds the
+ * expected output (source * 3) and the output read back from L2 to its
+ * own partial checksums instead of comparing bytes.
+ */
+static void checksum_slice(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+    int core     = pi_core_id();
+    int nb_cores = pi_cl_team_nb_cores();
+    int slice    = (test->size / nb_cores) & ~3;
+    int start    = slice * core;
+    int end      = (core == nb_cores - 1) ? test->size : start + slice;
+
+    char *ref = test->verify_scratch + 2*VERIFY_TILE*core;
+    char *out = ref + VERIFY_TILE;
+    pi_cl_dma_cmd_t cmd_ref, cmd_out;
+
+    test->core_expected[core] = (checksum_t){0};
+    test->core_readback[core] = (checksum_t){0};
+
+    for (int off = start; off < end; off += VERIFY_TILE)
+    {
+        int len = end - off < VERIFY_TILE ? end - off : VERIFY_TILE;
+
+        pi_cl_dma_cmd((uint32_t)test->src + off, (uint32_t)ref, len, PI_CL_DMA_DIR_EXT2LOC, &cmd_ref);
+        pi_cl_dma_cmd((uint32_t)test->dst + off, (uint32_t)out, len, PI_CL_DMA_DIR_EXT2LOC, &cmd_out);
+        pi_cl_dma_cmd_wait(&cmd_ref);
+        pi_cl_dma_cmd_wait(&cmd_out);
+
+        checksum_mul3(&test->core_expected[core], ref, len, off);
+        checksum_update(&test->core_readback[core], out, len, off);
+    }
+}
+
+/**
+ * @brief Read-back cluster task of VERIFY_CHECKSUM, split across the team
+ */
+static void checksum_entry(void *arg)
+{
+    pi_cl_team_fork(CL_NB_CORES, checksum_slice, arg);
+}
+
+/*=============================================================================
+ * ENERGY ESTIMATION
+ *============================================================================*/
+/**
+ * @brief Estimate the energy of a profiled run from the ENERGY_PJ_* table
+ * @return Estimated energy in pJ
+ *
+ * E = cluster cycles * CL_CYCLE           (master cycles over the three phases)
+ *   + active cycles of all cores * CORE_ACTIVE
+ *   + DMA bytes * DMA_BYTE
+ *   + bytes copied by the cores * CORE_L2_BYTE
+ *
+ * Processing cycles are already covered by the active cycles, so a
+ * configuration that keeps the cores busy less, or moves more bytes through
+ * the DMA, can win on energy while losing on cycles.
+ */
+static uint32_t energy_estimate(const dma_test_t *test)
+{
+    uint32_t cl_cycles = test->phase_cycles[0] + test->phase_cycles[1] + test->phase_cycles[2];
+    uint32_t active = 0;
+    for (int c = 0; c < CL_NB_CORES; c++)
+        active += test->perf[c].active;
+
+    uint32_t core_bytes = 2*test->size - test->dma_bytes;
+
+    return cl_cycles * ENERGY_PJ_CL_CYCLE + active * ENERGY_PJ_CORE_ACTIVE +
+           test->dma_bytes * ENERGY_PJ_DMA_BYTE + core_bytes * ENERGY_PJ_CORE_L2_BYTE;
+}
+
+/*=============================================================================
+ * INDIVIDUAL TEST EXECUTION
+ *============================================================================*/
+/**
+ * @brief Apply the global run options to a configuration and clear its results
+ */
+static void reset_dma_results(dma_test_t *test)
+{
+    // Per-test values win, unset ones take the build-time default
+    if (!test->energy)
+        test->energy = ENERGY_ESTIMATE;
+    if (!test->profile)
+        test->profile = PERF_PROFILE;
+    if (!test->profile && (test->energy || test->trace))
+        test->profile = 1;
+    // Custom task bodies collect no counters, so they get no profile or energy
+    if (test->entry)
+        test->profile = test->energy = 0;
+    test->dma_bytes = test->energy_pj = 0;
+    for (int i = 0; i < 3; i++)
+        test->phase_cycles[i] = 0;
+    for (int i = 0; i < CL_NB_CORES; i++)
+    {
+        test->proc_cycles[i] = test->tcdm_cont[i] = 0;
+        test->perf[i] = (cl_perf_t){0};
+        test->core_checksum[i] = (checksum_t){0};
+    }
+    test->checksum = (checksum_t){0};
+}
+
+/**
+ * @brief Validate a configuration, take its L1 memory and reset its results
+ * @return 0 on success, -1 on an invalid configuration or allocation failure
+ *
+ * src and dst point into ext_buff0/ext_buff1 afterwards, or into their L1
+ * images with l1_ends; callers streaming other L2 buffers through
+ * cluster_entry may redirect them between tasks.
+ */
+static int setup_dma_test(dma_test_t *test)
+{
+    // Every chunk must carry at least one byte and offsets must fit the padding
+    if (test->size > BUFF_SIZE || test->size < test->nb_copy * test->nb_iter ||
+        test->src_off > ALIGN_MAX_OFFSET || test->dst_off > ALIGN_MAX_OFFSET ||
+        test->loc_off > ALIGN_MAX_OFFSET || test->nb_cores > CL_NB_CORES ||
+        test->copy_cores > CL_NB_CORES ||
+        (test->copy_cores > 1 && !XFER_IS_CPU(test->policy)) ||
+        (test->schedule == SCHED_INTERLEAVED && test->copy_cores > 1))
+    {
+        printf("Invalid test configuration!\n");
+        return -1;
+    }
+
+    /*-------------------------------------------------------------------------
+     * MEMORY ALLOCATION
+     *------------------------------------------------------------------------*/
+    // Take the tile buffer and the DMA descriptors from the L1 arena
+    // (fast TCDM), the buffer aligned on 8 bytes before applying the offset
+    l1_arena_reset();
+    loc_buff = l1_arena_alloc(l1_footprint(test) + BUFF_PAD, BUFF_PAD);
+    test->xfers = l1_arena_alloc(test->nb_copy * sizeof(dma_xfer_t), 4);
+    char *l1_ends = test->l1_ends ? l1_arena_alloc(2*(BUFF_SIZE + BUFF_PAD), BUFF_PAD) : NULL;
+    if (!test->trace)
+        test->trace = TRACE_EVENTS;
+    if (test->entry || test->standalone)
+        test->trace = 0;    // Only cluster_entry records events, and only run_dma_test() dumps them
+    if (test->verify_mode == VERIFY_FC)
+        test->verify_mode = VERIFY_MODE;
+    if (test->entry && test->verify_mode == VERIFY_CHECKSUM)
+        test->verify_mode = VERIFY_FC;  // Only cluster_entry keeps tile checksums
+    if (test->standalone)
+        test->verify_mode = VERIFY_FC;
+    test->verify_scratch = NULL;
+    if (test->verify_mode == VERIFY_CLUSTER || test->verify_mode == VERIFY_CHECKSUM)
+        test->verify_scratch = l1_arena_alloc(2*VERIFY_TILE*CL_NB_CORES, 4);
+    // Last, as the rings take what the run leaves of the arena
+    test->rings = test->trace ? trace_alloc(test) : NULL;
+
+    if (!loc_buff || !test->xfers || (test->l1_ends && !l1_ends) ||
+        (test->verify_mode != VERIFY_FC && !test->verify_scratch) ||
+        (test->trace && !test->rings))
+    {
+        printf("Failed to allocate L1 buffer!\n");
+        return -1;
+    }
+
+    test->src = (l1_ends ? l1_ends : ext_buff0) + test->src_off;
+    test->dst = (l1_ends ? l1_ends + BUFF_SIZE + BUFF_PAD : ext_buff1) + test->dst_off;
+    test->loc = loc_buff + test->loc_off;
+    test->tile_stride = l1_tile_stride(test);
+
+    reset_dma_results(test);
+    return 0;
+}
+
+/**
+ * @brief Check the output of a finished run according to its verify mode
+ * @return 0 if the output is correct, -1 otherwise
+ *
+ * Records the verification result and the FC cycles spent on it. With
+ * VERIFY_CHECKSUM, the read-back task runs first and is timed on its own
+ * (readback_cycles); the FC window then only adds and compares checksums.
+ */
+static int verify_dma_test(dma_test_t *test)
+{
+    if (test->verify_mode == VERIFY_CHECKSUM)
+    {
+        struct pi_cluster_task cluster_task;
+        pi_cluster_task(&cluster_task, checksum_entry, test);
+
+        pi_perf_conf(1 << PI_PERF_CYCLES);
+        pi_perf_reset();
+        pi_perf_start();
+        pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
+        pi_perf_stop();
+        test->readback_cycles = pi_perf_read(PI_PERF_CYCLES);
+    }
+
+    // Verify correctness: check if processing was applied correctly
+    // Expected result: original value * 3 (with 8-bit wraparound)
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    int error, tiles_ok = 1, l2_ok = 1;
+    if (test->verify_mode == VERIFY_CHECKSUM)
+    {
+        // Partial checksums add up; the read-back of L2 catches what went
+        // wrong after the tiles were checksummed (write-back address, lost
+        // chunk). Only the checksums are compared, no byte position is known
+        test->checksum = test->expected = test->readback = (checksum_t){0};
+        for (int c = 0; c < CL_NB_CORES; c++)
+        {
+            test->checksum.sum  += test->core_checksum[c].sum;
+            test->checksum.wsum += test->core_checksum[c].wsum;
+            test->expected.sum  += test->core_expected[c].sum;
+            test->expected.wsum += test->core_expected[c].wsum;
+            test->readback.sum  += test->core_readback[c].sum;
+            test->readback.wsum += test->core_readback[c].wsum;
+        }
+
+        tiles_ok = test->checksum.sum == test->expected.sum &&
+                   test->checksum.wsum == test->expected.wsum;
+        l2_ok    = test->readback.sum == test->expected.sum &&
+                   test->readback.wsum == test->expected.wsum;
+        error = !tiles_ok || !l2_ok;
+        test->verify.first = -1;
+        test->verify.count = error;
+    }
+    else
+    {
+        if (test->verify_mode == VERIFY_CLUSTER)
+        {
+            struct pi_cluster_task cluster_task;
+            pi_cluster_task(&cluster_task, verify_entry, test);
+            pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
+
+            test->verify.first = -1;
+            test->verify.count = 0;
+            for (int c = 0; c < CL_NB_CORES; c++)
+            {
+                if (test->core_verify[c].count && test->verify.first < 0)
+                    test->verify.first = test->core_verify[c].first;
+                test->verify.count += test->core_verify[c].count;
+            }
+        }
+        else
+            verify_scaled(test->src, test->dst, test->size, 3, &test->verify);
+
+        error = test->verify.count != 0;
+    }
+
+    pi_perf_stop();
+    test->verify_cycles = pi_perf_read(PI_PERF_CYCLES);
+    test->error = error;
+
+    if (error && test->verify_mode == VERIFY_CHECKSUM)
+        printf("Verification: checksum mismatch (Tiles=%s L2=%s)\n",
+               tiles_ok ? "OK" : "BAD", l2_ok ? "OK" : "BAD");
+    else if (error)
+        printf("Verification: %d wrong bytes, first at index %d\n",
+               test->verify.count, test->verify.first);
+
+    return error ? -1 : 0;
+}
+
+/**
+ * @brief Execute DMA test for a specific parameter combination
+ * @param test Parameters of the run; cycles and error are filled in
+ * @return 0 on success, -1 on failure
+ * 
+ * This function:
+ * 1. Takes L1 memory from the arena and initializes test data
+ * 2. Configures and runs the cluster task with specified parameters
+ * 3. Measures execution time in cycles
+ * 4. Verifies data correctness
+ *
+ * The cluster must already be open and the L1 arena reserved (test_entry).
+ */
+static int run_dma_test(dma_test_t *test)
+{
+    test->cycles = 0;
+    test->error = 1;
+
+    if (setup_dma_test(test))
+        return -1;
+
+    /*-------------------------------------------------------------------------
+     * TEST DATA INITIALIZATION  
+     *------------------------------------------------------------------------*/
+    // Fill external buffer with test data (DATA_PATTERN, pseudo-random by default)
+    fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+
+    // Clear destination so a stale result from a previous run cannot pass
+    for (int i = 0; i < BUFF_SIZE + BUFF_PAD; i++)
+        ext_buff1[i] = 0;
+
+    // L1 images are written by the FC through the global L1 alias
+    if (test->l1_ends)
+    {
+        memcpy(test->src - test->src_off, ext_buff0, BUFF_SIZE + BUFF_PAD);
+        memset(test->dst - test->dst_off, 0, BUFF_SIZE + BUFF_PAD);
+    }
+
+    /*-------------------------------------------------------------------------
+     * CLUSTER TASK SETUP
+     *------------------------------------------------------------------------*/
+    // Pass DMA parameters to cluster task
+    struct pi_cluster_task cluster_task;
+    pi_cluster_task(&cluster_task, test->entry ? test->entry : cluster_entry, test);
+
+    /*-------------------------------------------------------------------------
+     * PERFORMANCE MEASUREMENT
+     *------------------------------------------------------------------------*/
+    // Performance measurement: configure cycle counter
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    // Execute the DMA test on cluster
+    pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
+
+    // Stop performance measurement and read results
+    pi_perf_stop();
+    test->cycles = pi_perf_read(PI_PERF_CYCLES);
+
+    if (test->energy)
+        test->energy_pj = energy_estimate(test);
+    if (test->rings)
+        trace_dump(test);
+
+    /*-------------------------------------------------------------------------
+     * RESULT VERIFICATION
+     *------------------------------------------------------------------------*/
+    return verify_dma_test(test);
+}
+
+//=============================================================================
+// Run Details Report
+//=============================================================================
+// Print the verification cost when it does not run on the FC, the energy
+// estimate and, for a profiled run, IPC and stall fractions summed over the cores
+static void report_details(const dma_test_t *test)
+{
+    if (test->verify_mode == VERIFY_CHECKSUM)
+        printf("  VERIFY Mode=%s Cycles=%u Readback=%u\n",
+               verify_mode_names[test->verify_mode], test->verify_cycles, test->readback_cycles);
+    else if (test->verify_mode != VERIFY_FC)
+        printf("  VERIFY Mode=%s Cycles=%u\n",
+               verify_mode_names[test->verify_mode], test->verify_cycles);
+
+    if (test->energy)
+    {
+        uint32_t pj_per_byte = test->energy_pj / test->size;
+        printf("  ENERGY Read=%u Proc=%u Write=%u DmaBytes=%u E=%u.%03u nJ nJ/B=%u.%03u\n",
+               test->phase_cycles[0], test->phase_cycles[1], test->phase_cycles[2],
+               test->dma_bytes, test->energy_pj / 1000, test->energy_pj % 1000,
+               pj_per_byte / 1000, pj_per_byte % 1000);
+    }
+
+    if (!test->profile)
+        return;
+
+    cl_perf_t sum = {0};
+    for (int c = 0; c < CL_NB_CORES; c++)
+    {
+        const cl_perf_t *p = &test->perf[c];
+        sum.cycles    += p->cycles;
+        sum.active    += p->active;
+        sum.instr     += p->instr;
+        sum.ld_stall  += p->ld_stall;
+        sum.tcdm_cont += p->tcdm_cont;
+        sum.imiss     += p->imiss;
+
+        if (test->profile > 1 || PERF_PROFILE > 1)
+            printf("  Core=%d Cycles=%u Active=%u Instr=%u LdStall=%u TcdmCont=%u IMiss=%u\n",
+                   c, p->cycles, p->active, p->instr, p->ld_stall, p->tcdm_cont, p->imiss);
+    }
+
+    // Fractions are relative to active cycles; idle slaves only add to Cycles
+    float active = sum.active ? (float)sum.active : 1.0f;
+    printf("  PROFILE Cores=%d IPC=%.2f Active=%.1f%% LdStall=%.1f%% TcdmCont=%.1f%% IMiss=%.1f%%\n",
+           CL_NB_CORES, sum.instr / active,
+           100.0f * sum.active / (sum.cycles ? sum.cycles : 1),
+           100.0f * sum.ld_stall / active, 100.0f * sum.tcdm_cont / active,
+           100.0f * sum.imiss / active);
+}
+
+//=============================================================================
+// Alignment Sweep
+//=============================================================================
+/**
+ * @brief Fit the per-byte costs of dma_model from single-chunk reads
+ * @return 0 if every calibration run passed, -1 otherwise
+ *
+ * Each cost is the slope of the read-phase cycles between two sizes, which
+ * cancels the fixed issue and wait overhead: word-aligned DMA, DMA from a
+ * misaligned source, and the byte copy the split uses for heads and tails.
+ * The values are printed in the form of the DMA_MODEL_* defines.
+ */
+static int dma_model_calibrate()
+{
+    struct
+    {
+        int src_off;        // Byte offset of the source
+        int policy;         // Transfer policy measured
+        uint32_t *cpb;      // Model cost fitted from the two runs
+    } fits[] = {
+        {0, XFER_DMA,      &dma_model.aligned_cpb},
+        {1, XFER_DMA,      &dma_model.misaligned_cpb},
+        {0, XFER_CPU_BYTE, &dma_model.core_cpb},
+    };
+    int size_values[] = {1024, 2048};     // Bytes moved by the two runs of each fit
+    int errors = 0;
+
+    for (int f = 0; f < sizeof(fits)/sizeof(fits[0]); f++)
+    {
+        uint32_t cycles[2];
+
+        for (int s = 0; s < 2; s++)
+        {
+            // The read phase of a profiled run is the single transfer
+            dma_test_t test = {
+                .nb_copy = 1, .nb_iter = 1, .size = size_values[s],
+                .src_off = fits[f].src_off, .policy = fits[f].policy, .profile = 1,
+            };
+            errors += run_dma_test(&test) != 0;
+            cycles[s] = test.phase_cycles[0];
+        }
+
+        // A non-increasing pair is noise; keep the previous value
+        if (cycles[1] > cycles[0])
+            *fits[f].cpb = ((cycles[1] - cycles[0]) << 8) / (size_values[1] - size_values[0]);
+    }
+
+    printf("Model: DMA_MODEL_ALIGNED_CPB=%u DMA_MODEL_MISALIGNED_CPB=%u DMA_MODEL_CORE_CPB=%u "
+           "DMA_MODEL_SPLIT_CYCLES=%u (static)\n",
+           dma_model.aligned_cpb, dma_model.misaligned_cpb, dma_model.core_cpb,
+           dma_model.split_cycles);
+
+    return errors ? -1 : 0;
+}
+
+// Execute the pipeline with misaligned buffers and non power-of-two sizes,
+// once with plain DMA commands and once through the splitting wrapper,
+// after refitting the split cost model (DMA_MODEL_CALIBRATE).
+// Unless ALIGN_FULL_CUBE is set, only offset combinations with at most one
+// misaligned buffer or the same offset on all three are run.
+static int align_sweep()
+{
+    int src_off_values[] = {ALIGN_SRC_OFFSETS};       // Byte offset of ext_buff0
+    int dst_off_values[] = {ALIGN_DST_OFFSETS};       // Byte offset of ext_buff1
+    int loc_off_values[] = {ALIGN_LOC_OFFSETS};       // Byte offset of loc_buff
+    int size_values[]    = {2048, 2047, 1536, 1000, 100};  // Bytes moved
+    int errors = 0;
+
+    printf("Starting DMA alignment sweep (NB_COPY=%d NB_ITER=%d, %s)...\n",
+           ALIGN_NB_COPY, ALIGN_NB_ITER, ALIGN_FULL_CUBE ? "full offset cube" : "offset subset");
+
+    // SPLIT decisions below use the costs measured on this target
+    if (DMA_MODEL_CALIBRATE)
+        errors += dma_model_calibrate() != 0;
+
+    for (int s = 0; s < sizeof(size_values)/sizeof(int); s++)
+        for (int a = 0; a < sizeof(src_off_values)/sizeof(int); a++)
+            for (int b = 0; b < sizeof(dst_off_values)/sizeof(int); b++)
+                for (int c = 0; c < sizeof(loc_off_values)/sizeof(int); c++)
+                {
+                    int nb_misaligned = (src_off_values[a] != 0) + (dst_off_values[b] != 0) +
+                                        (loc_off_values[c] != 0);
+                    int diagonal = src_off_values[a] == dst_off_values[b] &&
+                                   dst_off_values[b] == loc_off_values[c];
+                    if (!ALIGN_FULL_CUBE && nb_misaligned > 1 && !diagonal)
+                        continue;
+
+                    for (int p = XFER_DMA; p <= XFER_SPLIT; p++)
+                    {
+                        dma_test_t test = {
+                            .nb_copy = ALIGN_NB_COPY, .nb_iter = ALIGN_NB_ITER,
+                            .size = size_values[s], .src_off = src_off_values[a],
+                            .dst_off = dst_off_values[b], .loc_off = loc_off_values[c],
+                            .policy = p,
+                        };
+                        errors += run_dma_test(&test) != 0;
+
+                        printf("SRC_OFF=%d DST_OFF=%d LOC_OFF=%d Size=%d Policy=%s Cycles=%u Result=%s\n",
+                               test.src_off, test.dst_off, test.loc_off, test.size,
+                               xfer_policy_names[p], test.cycles, test.error ? "FAIL" : "SUCCESS");
+                        report_details(&test);
+                    }
+                }
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// L1 Layout Sweep
+//=============================================================================
+// Compare TCDM contention of the contiguous and bank-interleaved layouts while
+// all cores process the tiles
+static int layout_sweep()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int errors = 0;
+
+    printf("Starting L1 layout sweep (%d cores, %d banks)...\n", CL_NB_CORES, TCDM_NB_BANKS);
+
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+            for (int l = 0; l < L1_NB_LAYOUTS; l++)
+            {
+                dma_test_t test = {
+                    .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                    .size = BUFF_SIZE, .nb_cores = CL_NB_CORES, .layout = l,
+                };
+                errors += run_dma_test(&test) != 0;
+
+                uint32_t cont = 0, proc = 0;
+                for (int c = 0; c < CL_NB_CORES; c++)
+                {
+                    cont += test.tcdm_cont[c];
+                    if (test.proc_cycles[c] > proc)
+                        proc = test.proc_cycles[c];
+                }
+
+                printf("NB_COPY=%d NB_ITER=%d Layout=%s Cycles=%u ProcCycles=%u TcdmCont=%u Result=%s\n",
+                       test.nb_copy, test.nb_iter, l1_layout_names[l], test.cycles,
+                       proc, cont, test.error ? "FAIL" : "SUCCESS");
+                report_details(&test);
+            }
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// CPU Copy Baseline
+//=============================================================================
+// Move each transfer size once with the DMA and once with every CPU-driven
+// copy variant (master only and all cores), and report the smallest size
+// from which the DMA beats the best CPU copy. The crossover against the
+// master-only copies calibrates the hybrid transfer policy.
+static int cpu_baseline_sweep()
+{
+    int size_values[] = {32, 64, 128, 256, 512, 1024, 2048};  // Bytes per transfer
+    int cores_values[] = {1, CL_NB_CORES};                     // Cores sharing a CPU copy
+    int nb_sizes = sizeof(size_values)/sizeof(int);
+    int crossover = -1, single_crossover = -1, single_policy = XFER_CPU_UNROLL;
+    int errors = 0;
+
+    printf("Starting CPU copy baseline (NB_COPY=1 NB_ITER=1)...\n");
+
+    for (int s = 0; s < nb_sizes; s++)
+    {
+        uint32_t dma_cycles = 0, best_cpu = 0xFFFFFFFF, best_single = 0xFFFFFFFF;
+        int best_single_policy = XFER_CPU_UNROLL;
+
+        for (int p = XFER_DMA; p <= XFER_CPU_UNROLL; p++)
+        {
+            if (p == XFER_SPLIT)
+                continue;
+
+            for (int c = 0; c < sizeof(cores_values)/sizeof(int); c++)
+            {
+                if (p == XFER_DMA && c > 0)
+                    break;
+
+                dma_test_t test = {
+                    .nb_copy = 1, .nb_iter = 1, .size = size_values[s],
+                    .policy = p, .copy_cores = p == XFER_DMA ? 0 : cores_values[c],
+                };
+                errors += run_dma_test(&test) != 0;
+
+                printf("Size=%d Policy=%s Cores=%d Cycles=%u Result=%s\n",
+                       test.size, xfer_policy_names[p], p == XFER_DMA ? 1 : cores_values[c],
+                       test.cycles, test.error ? "FAIL" : "SUCCESS");
+                report_details(&test);
+
+                if (p == XFER_DMA)
+                    dma_cycles = test.cycles;
+                else
+                {
+                    if (test.cycles < best_cpu)
+                        best_cpu = test.cycles;
+                    if (cores_values[c] == 1 && test.cycles < best_single)
+                    {
+                        best_single = test.cycles;
+                        best_single_policy = p;
+                    }
+                }
+            }
+        }
+
+        // Crossover is the first size of the final run where the DMA wins
+        if (dma_cycles < best_cpu)
+        {
+            if (crossover < 0)
+                crossover = size_values[s];
+        }
+        else
+            crossover = -1;
+
+        if (dma_cycles < best_single)
+        {
+            if (single_crossover < 0)
+                single_crossover = size_values[s];
+        }
+        else
+        {
+            single_crossover = -1;
+            single_policy = best_single_policy;
+        }
+    }
+
+    if (crossover < 0)
+        printf("Crossover: CPU copy faster up to %d bytes\n", size_values[nb_sizes - 1]);
+    else
+        printf("Crossover: DMA faster from %d bytes\n", crossover);
+
+    // Calibrate the hybrid policy against copies done by the issuing core
+    xfer_calib.valid = 1;
+    xfer_calib.cpu_threshold = single_crossover < 0 ? size_values[nb_sizes - 1] + 1 : single_crossover;
+    xfer_calib.cpu_policy = single_policy;
+    printf("Calibration: XFER_CALIB_THRESHOLD=%d XFER_CALIB_POLICY=%d (%s)\n",
+           xfer_calib.cpu_threshold, xfer_calib.cpu_policy, xfer_policy_names[xfer_calib.cpu_policy]);
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// Hybrid Transfer Sweep
+//=============================================================================
+// Run the 16 configurations with DMA-only and hybrid transfers
+static int hybrid_sweep()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int errors = 0;
+
+    if (!xfer_calib.valid)
+        errors += cpu_baseline_sweep() != 0;
+
+    printf("Starting hybrid transfer sweep (CPU %s below %d bytes)...\n",
+           xfer_policy_names[xfer_calib.cpu_policy], xfer_calib.cpu_threshold);
+
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+            for (int p = XFER_DMA; p <= XFER_HYBRID; p += XFER_HYBRID)
+            {
+                dma_test_t test = {
+                    .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                    .size = BUFF_SIZE, .policy = p,
+                };
+                errors += run_dma_test(&test) != 0;
+
+                printf("NB_COPY=%d NB_ITER=%d Chunk=%d Policy=%s Cycles=%u Result=%s\n",
+                       test.nb_copy, test.nb_iter, test.size / test.nb_iter / test.nb_copy,
+                       xfer_policy_names[p], test.cycles, test.error ? "FAIL" : "SUCCESS");
+                report_details(&test);
+            }
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// Copy Path Benchmark
+//=============================================================================
+/**
+ * @brief FC-side L2->L2 copy paths
+ */
+typedef enum
+{
+    FC_COPY_MEMCPY = 0,     // FC memcpy()
+    FC_COPY_WORD   = 1,     // FC word loop
+    FC_COPY_NB_PATHS
+} fc_copy_e;
+
+static const char *fc_copy_names[FC_COPY_NB_PATHS] = {"L2L2_FC_MEMCPY", "L2L2_FC_WORD"};
+
+/**
+ * @brief Copy size bytes from ext_buff0 to ext_buff1 on the FC
+ * @return FC cycles of the copy alone
+ */
+static uint32_t fc_copy(int path, int size)
+{
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    if (path == FC_COPY_MEMCPY)
+        memcpy(ext_buff1, ext_buff0, size);
+    else
+    {
+        uint32_t *dst = (uint32_t *)ext_buff1;
+        const uint32_t *src = (const uint32_t *)ext_buff0;
+        int i;
+        for (i = 0; i < size / 4; i++)
+            dst[i] = src[i];
+        for (i *= 4; i < size; i++)
+            ext_buff1[i] = ext_buff0[i];
+    }
+
+    pi_perf_stop();
+    return pi_perf_read(PI_PERF_CYCLES);
+}
+
+// Time the copy paths that stay in one memory level for every size. The
+// cluster paths are pipeline runs: L2->L2 is the DMA round trip of the
+// plain pipeline, and the L1->L1 paths run it between L1 images of the
+// buffers (l1_ends), with the DMA, the master core or the whole team moving
+// the chunks. Their CopyCycles are the read and write phases of the
+// profile. The FC paths run no cluster task and time the FC copy alone.
+static int copy_path_sweep()
+{
+    static const struct
+    {
+        const char *name;
+        int l1_ends;        // L1->L1 instead of the L2->L1->L2 round trip
+        int policy;         // xfer_policy_e moving the chunks
+        int copy_cores;     // Cores sharing a CPU copy
+    } paths[] = {
+        {"L2L2_DMA",   0, XFER_DMA,        0},
+        {"L1L1_DMA",   1, XFER_DMA,        0},
+        {"L1L1_CORE",  1, XFER_CPU_UNROLL, 0},
+        {"L1L1_CORES", 1, XFER_CPU_UNROLL, CL_NB_CORES},
+    };
+    int size_values[] = {32, 64, 128, 256, 512, 1024, 2048};  // Bytes per copy
+    int errors = 0;
+
+    printf("Starting copy path benchmark (NB_COPY=1 NB_ITER=1)...\n");
+
+    for (int s = 0; s < sizeof(size_values)/sizeof(int); s++)
+    {
+        for (int p = 0; p < sizeof(paths)/sizeof(paths[0]); p++)
+        {
+            // Copy-only cycles come from the phase profile
+            dma_test_t test = {
+                .nb_copy = 1, .nb_iter = 1, .size = size_values[s], .profile = 1,
+                .l1_ends = paths[p].l1_ends, .policy = paths[p].policy,
+                .copy_cores = paths[p].copy_cores,
+            };
+            errors += run_dma_test(&test) != 0;
+
+            // The round trip is one L2->L2 copy, the L1 runs make two L1->L1 copies
+            uint32_t copy = test.phase_cycles[0] + test.phase_cycles[2];
+            uint32_t bytes = test.l1_ends ? 2*test.size : test.size;
+            uint32_t bpc = copy ? bytes * 100 / copy : 0;
+            printf("Size=%d Path=%s Policy=%s Cores=%d CopyCycles=%u Bytes/cycle=%u.%02u Cycles=%u Result=%s\n",
+                   test.size, paths[p].name, xfer_policy_names[test.policy],
+                   test.copy_cores > 1 ? test.copy_cores : 1, copy, bpc / 100, bpc % 100,
+                   test.cycles, test.error ? "FAIL" : "SUCCESS");
+            report_details(&test);
+        }
+
+        for (int p = 0; p < FC_COPY_NB_PATHS; p++)
+        {
+            fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+            memset(ext_buff1, 0, BUFF_SIZE + BUFF_PAD);
+
+            uint32_t copy = fc_copy(p, size_values[s]);
+
+            verify_result_t res;
+            verify_scaled(ext_buff0, ext_buff1, size_values[s], 1, &res);
+            errors += res.count != 0;
+
+            // Bytes per cycle in hundredths, the FC has no FPU on most targets
+            uint32_t bpc = copy ? size_values[s] * 100 / copy : 0;
+            printf("Size=%d Path=%s Policy=FC Cores=1 CopyCycles=%u Bytes/cycle=%u.%02u Cycles=%u Result=%s\n",
+                   size_values[s], fc_copy_names[p], copy, bpc / 100, bpc % 100, copy,
+                   res.count ? "FAIL" : "SUCCESS");
+        }
+    }
+
+    return errors ? -1 : 0;
+}
+
+#if L3_STAGING
+//=============================================================================
+// L3 Staging Benchmark
+//=============================================================================
+/**
+ * @brief Stream L3_NB_BLOCKS blocks from external RAM through the cluster
+ * @param ram      Open RAM device
+ * @param l3_src   L3 address of the source blocks
+ * @param l3_dst   L3 address of the result blocks
+ * @param l2       Four BUFF_SIZE L2 buffers: two inputs, two outputs
+ * @param test     Configuration set up by setup_dma_test()
+ * @param pipelined 0: read, process and write each block in turn
+ *                  1: read block k+1 and write block k-1 while the cluster
+ *                     processes block k
+ * @return FC cycles of the whole stream
+ *
+ * In pipelined mode the cluster task runs asynchronously, so the FC only
+ * sleeps on three events per block. Inputs and outputs alternate between
+ * two L2 buffers each, which keeps every concurrent transfer on a buffer
+ * nobody else touches.
+ */
+static uint32_t l3_stream(struct pi_device *ram, uint32_t l3_src, uint32_t l3_dst,
+                          char *l2, dma_test_t *test, int pipelined)
+{
+    char *in[2]  = {l2, l2 + BUFF_SIZE};
+    char *out[2] = {l2 + 2*BUFF_SIZE, l2 + 3*BUFF_SIZE};
+    struct pi_cluster_task task;
+    pi_task_t cl_done, rd_done, wr_done;
+
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    if (pipelined)
+        pi_ram_read(ram, l3_src, in[0], BUFF_SIZE);
+
+    for (int k = 0; k < L3_NB_BLOCKS; k++)
+    {
+        test->src = in[k & 1];
+        test->dst = out[k & 1];
+        pi_cluster_task(&task, cluster_entry, test);
+
+        if (!pipelined)
+        {
+            pi_ram_read(ram, l3_src + k*BUFF_SIZE, test->src, BUFF_SIZE);
+            pi_cluster_send_task_to_cl(&cluster_dev, &task);
+            pi_ram_write(ram, l3_dst + k*BUFF_SIZE, test->dst, BUFF_SIZE);
+            continue;
+        }
+
+        pi_cluster_send_task_to_cl_async(&cluster_dev, &task, pi_task_block(&cl_done));
+        if (k + 1 < L3_NB_BLOCKS)
+            pi_ram_read_async(ram, l3_src + (k + 1)*BUFF_SIZE, in[(k + 1) & 1], BUFF_SIZE,
+                              pi_task_block(&rd_done));
+        if (k > 0)
+            pi_ram_write_async(ram, l3_dst + (k - 1)*BUFF_SIZE, out[(k - 1) & 1], BUFF_SIZE,
+                               pi_task_block(&wr_done));
+
+        pi_task_wait_on(&cl_done);
+        if (k + 1 < L3_NB_BLOCKS)
+            pi_task_wait_on(&rd_done);
+        if (k > 0)
+            pi_task_wait_on(&wr_done);
+    }
+
+    if (pipelined)
+        pi_ram_write(ram, l3_dst + (L3_NB_BLOCKS - 1)*BUFF_SIZE,
+                     out[(L3_NB_BLOCKS - 1) & 1], BUFF_SIZE);
+
+    pi_perf_stop();
+    return pi_perf_read(PI_PERF_CYCLES);
+}
+
+// Stage source blocks in external RAM and measure the end-to-end stream,
+// serial and with the three levels pipelined; results are read back from
+// L3 and verified block by block
+static int l3_staging_sweep()
+{
+    struct pi_device ram;
+    struct pi_hyperram_conf ram_conf;
+    uint32_t l3_src, l3_dst;
+    uint32_t l3_size = L3_NB_BLOCKS * BUFF_SIZE;
+    int errors = 0;
+
+    printf("Starting L3 staging benchmark (%d blocks of %d bytes, NB_COPY=%d NB_ITER=%d)...\n",
+           L3_NB_BLOCKS, BUFF_SIZE, L3_NB_COPY, L3_NB_ITER);
+
+    pi_hyperram_conf_init(&ram_conf);
+    pi_open_from_conf(&ram, &ram_conf);
+    if (pi_ram_open(&ram))
+    {
+        printf("RAM open failed!\n");
+        return -1;
+    }
+
+    char *l2 = pi_l2_malloc(4*BUFF_SIZE);
+    int l3_ok = !pi_ram_alloc(&ram, &l3_src, l3_size);
+    if (l3_ok && pi_ram_alloc(&ram, &l3_dst, l3_size))
+    {
+        pi_ram_free(&ram, l3_src, l3_size);
+        l3_ok = 0;
+    }
+    if (!l2 || !l3_ok)
+    {
+        printf("Failed to allocate L2/L3 staging buffers!\n");
+        if (l3_ok)
+        {
+            pi_ram_free(&ram, l3_dst, l3_size);
+            pi_ram_free(&ram, l3_src, l3_size);
+        }
+        if (l2)
+            pi_l2_free(l2, 4*BUFF_SIZE);
+        pi_ram_close(&ram);
+        return -1;
+    }
+
+    // Source blocks are generated in L2 and written to L3 before timing
+    for (int k = 0; k < L3_NB_BLOCKS; k++)
+    {
+        fill_test_data(l2, BUFF_SIZE, DATA_PATTERN);
+        pi_ram_write(&ram, l3_src + k*BUFF_SIZE, l2, BUFF_SIZE);
+    }
+
+    dma_test_t test = {
+        .nb_copy = L3_NB_COPY, .nb_iter = L3_NB_ITER, .size = BUFF_SIZE, .standalone = 1,
+    };
+    if (setup_dma_test(&test))
+        errors++;
+
+    for (int pipelined = 0; pipelined < 2 && !errors; pipelined++)
+    {
+        // Clear the result blocks so a stale result cannot pass
+        memset(l2, 0, BUFF_SIZE);
+        for (int k = 0; k < L3_NB_BLOCKS; k++)
+            pi_ram_write(&ram, l3_dst + k*BUFF_SIZE, l2, BUFF_SIZE);
+
+        uint32_t cycles = l3_stream(&ram, l3_src, l3_dst, l2, &test, pipelined);
+
+        int wrong = 0;
+        for (int k = 0; k < L3_NB_BLOCKS; k++)
+        {
+            verify_result_t res;
+            pi_ram_read(&ram, l3_src + k*BUFF_SIZE, l2, BUFF_SIZE);
+            pi_ram_read(&ram, l3_dst + k*BUFF_SIZE, l2 + BUFF_SIZE, BUFF_SIZE);
+            verify_scaled(l2, l2 + BUFF_SIZE, BUFF_SIZE, 3, &res);
+            wrong += res.count;
+        }
+        errors += wrong != 0;
+
+        // Bytes per cycle in hundredths, counting each payload byte once
+        uint32_t bpc = cycles ? (uint32_t)((uint64_t)l3_size * 100 / cycles) : 0;
+        printf("L3 Mode=%s Bytes=%u Cycles=%u Bytes/cycle=%u.%02u Result=%s\n",
+               pipelined ? "PIPELINED" : "SERIAL", l3_size, cycles, bpc / 100, bpc % 100,
+               wrong ? "FAIL" : "SUCCESS");
+    }
+
+    pi_ram_free(&ram, l3_dst, l3_size);
+    pi_ram_free(&ram, l3_src, l3_size);
+    pi_l2_free(l2, 4*BUFF_SIZE);
+    pi_ram_close(&ram);
+
+    return errors ? -1 : 0;
+}
+#endif // L3_STAGING
+
+#if CONTENTION_SWEEP
+//=============================================================================
+// FC Contention Benchmark
+//=============================================================================
+/**
+ * @brief Kind of L2 traffic generated by the FC during the cluster task
+ */
+typedef enum
+{
+    LOAD_FC_MEMCPY = 0,     // FC core loads/stores (memcpy between two L2 buffers)
+    LOAD_UDMA      = 1,     // Peripheral-style uDMA writes to L2 (external RAM reads)
+    LOAD_NB_KINDS
+} fc_load_e;
+
+static const char *fc_load_names[LOAD_NB_KINDS] = {"FC_MEMCPY", "UDMA"};
+
+#define CONTENTION_SLOTS 4  // Load level n keeps n of every CONTENTION_SLOTS FC slots busy
+
+/**
+ * @brief FC-side traffic generator state
+ */
+typedef struct
+{
+    int kind;               // fc_load_e
+    int level;              // Busy slots out of CONTENTION_SLOTS
+    char *l2;               // Two CONTENTION_CHUNK L2 buffers
+    struct pi_device *ram;  // Open RAM device (LOAD_UDMA)
+    uint32_t l3;            // CONTENTION_CHUNK bytes of external RAM (LOAD_UDMA)
+    uint32_t bytes;         // L2 bytes moved by the FC while the cluster ran
+} fc_load_t;
+
+static void contention_done(void *arg)
+{
+    *(volatile int *)arg = 1;
+}
+
+/**
+ * @brief Run a prepared configuration while the FC loads L2
+ * @return Cluster cycles of the two DMA phases (read and write-back); the
+ *         L1-only processing phase is left in test->phase_cycles[1]
+ *
+ * The cluster task is sent asynchronously; until its completion callback
+ * fires, the FC cycles through CONTENTION_SLOTS slots and keeps load->level
+ * of them busy with one burst of traffic. Idle slots spin on registers only.
+ */
+static uint32_t run_contended(dma_test_t *test, fc_load_t *load)
+{
+    struct pi_cluster_task task;
+    pi_task_t done, udma;
+    volatile int finished = 0;
+
+    pi_cluster_task(&task, cluster_entry, test);
+    pi_cluster_send_task_to_cl_async(&cluster_dev, &task,
+                                     pi_task_callback(&done, contention_done, (void *)&finished));
+
+    for (int slot = 0; !finished; slot = (slot + 1) % CONTENTION_SLOTS)
+    {
+        if (slot < load->level && load->kind == LOAD_FC_MEMCPY)
+            memcpy(load->l2 + CONTENTION_CHUNK, load->l2, CONTENTION_CHUNK);
+        else if (slot < load->level)
+        {
+            pi_ram_read_async(load->ram, load->l3, load->l2, CONTENTION_CHUNK, pi_task_block(&udma));
+            pi_task_wait_on(&udma);
+        }
+        else
+        {
+            for (int i = 0; i < CONTENTION_IDLE_NOPS; i++)
+                __asm__ volatile("nop");
+        }
+
+        if (slot < load->level)
+            load->bytes += CONTENTION_CHUNK;
+
+        // Lets the runtime process the cluster completion event
+        pi_yield();
+    }
+
+    return test->phase_cycles[0] + test->phase_cycles[2];
+}
+
+// Measure the cluster pipeline under increasing FC load of both kinds and
+// report the slowdown against the unloaded run
+static int contention_sweep()
+{
+    struct pi_device ram;
+    struct pi_hyperram_conf ram_conf;
+    fc_load_t load = {0};
+    int errors = 0;
+
+    printf("Starting FC contention benchmark (NB_COPY=2 NB_ITER=4, %d-byte bursts)...\n",
+           CONTENTION_CHUNK);
+
+    load.l2 = pi_l2_malloc(2*CONTENTION_CHUNK);
+    if (!load.l2)
+    {
+        printf("Failed to allocate L2 load buffers!\n");
+        return -1;
+    }
+
+    // uDMA traffic needs the external RAM; without it only FC memcpy runs
+    pi_hyperram_conf_init(&ram_conf);
+    pi_open_from_conf(&ram, &ram_conf);
+    int nb_kinds = LOAD_NB_KINDS;
+    if (pi_ram_open(&ram))
+        nb_kinds = LOAD_UDMA;
+    else if (pi_ram_alloc(&ram, &load.l3, CONTENTION_CHUNK))
+    {
+        pi_ram_close(&ram);
+        nb_kinds = LOAD_UDMA;
+    }
+    load.ram = &ram;
+    if (nb_kinds == LOAD_UDMA)
+        printf("RAM unavailable, uDMA load skipped\n");
+
+    for (int kind = 0; kind < nb_kinds; kind++)
+    {
+        uint32_t base = 0;
+
+        for (int level = 0; level <= CONTENTION_SLOTS; level++)
+        {
+            // Cluster-side phase cycles need the profile
+            dma_test_t test = {.nb_copy = 2, .nb_iter = 4, .size = BUFF_SIZE, .profile = 1,
+                               .standalone = 1};
+            if (setup_dma_test(&test))
+            {
+                errors++;
+                break;
+            }
+            fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+            memset(ext_buff1, 0, BUFF_SIZE + BUFF_PAD);
+
+            load.kind  = kind;
+            load.level = level;
+            load.bytes = 0;
+            uint32_t cycles = run_contended(&test, &load);
+
+            verify_result_t res;
+            verify_scaled(test.src, test.dst, test.size, 3, &res);
+            errors += res.count != 0;
+
+            if (level == 0)
+                base = cycles;
+
+            // DMA bytes/cycle and slowdown in hundredths, over the DMA phases
+            uint32_t bpc  = cycles ? 2*test.size*100 / cycles : 0;
+            uint32_t slow = base ? cycles*100 / base : 0;
+            printf("Load=%s Level=%d%% DmaCycles=%u Bytes/cycle=%u.%02u Slowdown=%u.%02ux ProcCycles=%u FcBytes=%u Result=%s\n",
+                   fc_load_names[kind], 100*level / CONTENTION_SLOTS, cycles, bpc / 100, bpc % 100,
+                   slow / 100, slow % 100, test.phase_cycles[1], load.bytes,
+                   res.count ? "FAIL" : "SUCCESS");
+        }
+    }
+
+    if (nb_kinds == LOAD_NB_KINDS)
+    {
+        pi_ram_free(&ram, load.l3, CONTENTION_CHUNK);
+        pi_ram_close(&ram);
+    }
+    pi_l2_free(load.l2, 2*CONTENTION_CHUNK);
+
+    return errors ? -1 : 0;
+}
+#endif // CONTENTION_SWEEP
+
+//=============================================================================
+// Asynchronous Sweep Driver
+//=============================================================================
+#define ASYNC_NB_SETS 3     // L2 buffer sets: being filled, being processed, being verified
+
+/**
+ * @brief Fill the source of a configuration in its L2 set and clear its destination
+ *
+ * Runs while the previous configuration is on the cluster, so the fill
+ * always stays on the FC.
+ */
+static void async_prepare(dma_test_t *test, char *src, char *dst)
+{
+    fill_test_data_fc(src, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+    memset(dst, 0, BUFF_SIZE + BUFF_PAD);
+    test->src = src + test->src_off;
+    test->dst = dst + test->dst_off;
+}
+
+/**
+ * @brief Run the 16 configurations with the FC overlapping the cluster
+ * @param tests Configurations, results are filled in
+ * @param sets  ASYNC_NB_SETS pairs of source/destination L2 buffers
+ * @return Number of failed configurations
+ *
+ * While the cluster runs configuration k from set k%3, the FC fills the
+ * set of configuration k+1 and verifies configuration k-1. The L1 arena is
+ * only set up between tasks, when no configuration uses it. Per-configuration
+ * timing comes from the cluster-side phase cycles, which the FC work cannot
+ * inflate; cluster-side verification would need L1 during the next task, so
+ * VERIFY_CLUSTER and VERIFY_CHECKSUM fall back to FC verification.
+ */
+static int async_run(dma_test_t *tests, int nb_tests, char **sets)
+{
+    struct pi_cluster_task task;
+    pi_task_t done;
+    int errors = 0;
+
+    async_prepare(&tests[0], sets[0], sets[1]);
+
+    for (int k = 0; k < nb_tests; k++)
+    {
+        dma_test_t *test = &tests[k];
+        char *src = test->src, *dst = test->dst;
+
+        // setup_dma_test() points src/dst at ext_buff0/1; restore the set's
+        if (setup_dma_test(test))
+        {
+            errors++;
+            continue;
+        }
+        test->verify_mode = VERIFY_FC;  // Cluster-side verification needs the cluster
+        test->src = src;
+        test->dst = dst;
+
+        pi_cluster_task(&task, cluster_entry, test);
+        pi_cluster_send_task_to_cl_async(&cluster_dev, &task, pi_task_block(&done));
+
+        if (k + 1 < nb_tests)
+        {
+            int set = (k + 1) % ASYNC_NB_SETS;
+            async_prepare(&tests[k + 1], sets[2*set], sets[2*set + 1]);
+        }
+        if (k > 0)
+            errors += verify_dma_test(&tests[k - 1]) != 0;
+
+        pi_task_wait_on(&done);
+
+        test->cycles = test->phase_cycles[0] + test->phase_cycles[1] + test->phase_cycles[2];
+        if (test->energy)
+            test->energy_pj = energy_estimate(test);
+        // The rings live in the arena until the next configuration is set up
+        if (test->rings)
+            trace_dump(test);
+    }
+
+    if (nb_tests)
+        errors += verify_dma_test(&tests[nb_tests - 1]) != 0;
+
+    return errors;
+}
+
+// Run the main sweep with synchronous dispatch and with the asynchronous
+// driver and compare their wall time. Both use the cluster-side phase
+// cycles (counter profile) so the per-configuration numbers match.
+static int async_sweep()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    static dma_test_t tests[16];          // Several live configurations: static (see dma_test_t)
+    int nb_tests = 0;
+    int errors = 0;
+
+    printf("Starting asynchronous sweep driver (%d L2 buffer sets)...\n", ASYNC_NB_SETS);
+
+    char *l2 = pi_l2_malloc(2*ASYNC_NB_SETS*(BUFF_SIZE + BUFF_PAD));
+    if (!l2)
+    {
+        printf("Failed to allocate L2 buffer sets!\n");
+        return -1;
+    }
+    char *sets[2*ASYNC_NB_SETS];
+    for (int i = 0; i < 2*ASYNC_NB_SETS; i++)
+        sets[i] = l2 + i*(BUFF_SIZE + BUFF_PAD);
+
+    // Synchronous reference: fill, run and verify one configuration at a time
+    uint32_t t0 = pi_time_get_us();
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+        {
+            dma_test_t test = {
+                .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                .size = BUFF_SIZE, .profile = 1,
+            };
+            errors += run_dma_test(&test) != 0;
+            tests[nb_tests++] = (dma_test_t){
+                .nb_copy = test.nb_copy, .nb_iter = test.nb_iter,
+                .size = BUFF_SIZE, .profile = 1,
+            };
+        }
+    uint32_t sync_us = pi_time_get_us() - t0;
+
+    t0 = pi_time_get_us();
+    errors += async_run(tests, nb_tests, sets);
+    uint32_t async_us = pi_time_get_us() - t0;
+
+    for (int k = 0; k < nb_tests; k++)
+    {
+        printf("NB_COPY=%d NB_ITER=%d Buffer=%d ClCycles=%u Result=%s\n",
+               tests[k].nb_copy, tests[k].nb_iter, tests[k].size, tests[k].cycles,
+               tests[k].error ? "FAIL" : "SUCCESS");
+        report_details(&tests[k]);
+    }
+    printf("Sweep wall time: Sync=%u us Async=%u us\n", sync_us, async_us);
+
+    pi_l2_free(l2, 2*ASYNC_NB_SETS*(BUFF_SIZE + BUFF_PAD));
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// Persistent Cluster Worker
+//=============================================================================
+/**
+ * @brief Work a job asks the cluster to do
+ */
+typedef enum
+{
+    KERNEL_NOP    = 0,  // Nothing: measures dispatch and completion only
+    KERNEL_SCALE3 = 1,  // The L2 -> L1 -> x3 -> L2 pipeline of cluster_entry()
+    KERNEL_EXIT   = 2,  // Stop the persistent worker
+    KERNEL_NB
+} kernel_e;
+
+static const char *kernel_names[KERNEL_NB] = {"NOP", "SCALE3", "EXIT"};
+
+/**
+ * @brief Job descriptor, written by the FC into the L2 queue
+ */
+typedef struct
+{
+    int kernel;         // kernel_e
+    char *src;          // L2 input
+    char *dst;          // L2 output
+    int size;           // Bytes to process
+    int nb_copy;        // DMA chunks per iteration (<= WORKER_MAX_COPY)
+    int nb_iter;        // Iterations over the buffer
+} job_t;
+
+/**
+ * @brief Single-producer (FC), single-consumer (cluster) ring in L2
+ *
+ * head and tail only grow; the FC owns head, the worker owns tail. A job
+ * slot is free again once tail has moved past it, so tail also serves as
+ * the completion count.
+ */
+typedef struct
+{
+    job_t jobs[JOB_QUEUE_DEPTH];
+    volatile uint32_t head;     // Jobs pushed by the FC
+    volatile uint32_t tail;     // Jobs completed by the worker
+    dma_test_t *ctx;            // L1 tile and DMA handles used by KERNEL_SCALE3
+} job_queue_t;
+
+static job_queue_t job_queue;
+
+// Orders plain job accesses against the volatile head/tail updates
+#define COMPILER_BARRIER() __asm__ volatile("" ::: "memory")
+
+/**
+ * @brief Execute one job on the master core (and its team)
+ */
+static void run_job(dma_test_t *ctx, const job_t *job)
+{
+    if (job->kernel != KERNEL_SCALE3)
+        return;
+
+    ctx->src     = job->src;
+    ctx->dst     = job->dst;
+    ctx->size    = job->size;
+    ctx->nb_copy = job->nb_copy;
+    ctx->nb_iter = job->nb_iter;
+    cluster_entry(ctx);
+}
+
+/**
+ * @brief Long-lived cluster task: execute queued jobs until KERNEL_EXIT
+ *
+ * The master core polls the queue in L2. This keeps the example portable;
+ * a production worker would sleep on a cluster event between jobs.
+ */
+static void worker_entry(void *arg)
+{
+    job_queue_t *q = (job_queue_t *)arg;
+    int kernel;
+
+    do
+    {
+        while (q->tail == q->head)
+            ;
+        COMPILER_BARRIER();
+
+        const job_t *job = &q->jobs[q->tail % JOB_QUEUE_DEPTH];
+        kernel = job->kernel;
+        run_job(q->ctx, job);
+
+        COMPILER_BARRIER();
+        q->tail++;
+    } while (kernel != KERNEL_EXIT);
+}
+
+/**
+ * @brief Queue a job for the worker, waiting for a free slot if needed
+ */
+static void job_push(job_queue_t *q, const job_t *job)
+{
+    while (q->head - q->tail >= JOB_QUEUE_DEPTH)
+        pi_yield();
+
+    q->jobs[q->head % JOB_QUEUE_DEPTH] = *job;
+    COMPILER_BARRIER();
+    q->head++;
+}
+
+/**
+ * @brief Wait until the worker has completed every job pushed so far
+ */
+static void job_drain(job_queue_t *q)
+{
+    while (q->tail != q->head)
+        pi_yield();
+}
+
+/**
+ * @brief Cluster task running a single job (task-per-job model)
+ */
+static void job_task_entry(void *arg)
+{
+    run_job(job_queue.ctx, (const job_t *)arg);
+}
+
+/**
+ * @brief FC cycles per job for one dispatch model
+ * @param model 0: one cluster task per job
+ *              1: persistent worker, FC waits for each job (latency)
+ *              2: persistent worker, FC streams all jobs (throughput)
+ */
+static uint32_t worker_measure(int model, const job_t *job)
+{
+    struct pi_cluster_task task;
+
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    for (int n = 0; n < WORKER_NB_JOBS; n++)
+    {
+        if (model == 0)
+        {
+            pi_cluster_task(&task, job_task_entry, (void *)job);
+            pi_cluster_send_task_to_cl(&cluster_dev, &task);
+            continue;
+        }
+
+        job_push(&job_queue, job);
+        if (model == 1)
+            job_drain(&job_queue);
+    }
+    if (model == 2)
+        job_drain(&job_queue);
+
+    pi_perf_stop();
+    return pi_perf_read(PI_PERF_CYCLES) / WORKER_NB_JOBS;
+}
+
+// Per-job cost of dispatching NOP and SCALE3 jobs as separate cluster tasks
+// and through the persistent worker's L2 queue
+static int worker_sweep()
+{
+    static const char *model_names[] = {"TASK_PER_JOB", "WORKER_LATENCY", "WORKER_STREAM"};
+    struct pi_cluster_task task;
+    pi_task_t worker_done;
+    int errors = 0;
+
+    printf("Starting persistent worker benchmark (%d jobs, queue depth %d)...\n",
+           WORKER_NB_JOBS, JOB_QUEUE_DEPTH);
+
+    // One L1 context sized for the largest job serves every job
+    dma_test_t ctx = {.nb_copy = WORKER_MAX_COPY, .nb_iter = 1, .size = BUFF_SIZE, .standalone = 1};
+    if (setup_dma_test(&ctx))
+        return -1;
+    job_queue.ctx  = &ctx;
+    job_queue.head = job_queue.tail = 0;
+
+    fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+
+    for (int model = 0; model < 3; model++)
+    {
+        if (model == 1)
+        {
+            pi_cluster_task(&task, worker_entry, &job_queue);
+            pi_cluster_send_task_to_cl_async(&cluster_dev, &task, pi_task_block(&worker_done));
+        }
+
+        for (int kernel = KERNEL_NOP; kernel <= KERNEL_SCALE3; kernel++)
+        {
+            job_t job = {
+                .kernel = kernel, .src = ext_buff0, .dst = ext_buff1,
+                .size = BUFF_SIZE, .nb_copy = 2, .nb_iter = 4,
+            };
+            memset(ext_buff1, 0, BUFF_SIZE + BUFF_PAD);
+
+            uint32_t cycles = worker_measure(model, &job);
+
+            // Every SCALE3 job rewrites the same output, so checking it once suffices
+            verify_result_t res = {-1, 0};
+            if (kernel == KERNEL_SCALE3)
+                verify_scaled(ext_buff0, ext_buff1, BUFF_SIZE, 3, &res);
+            errors += res.count != 0;
+
+            printf("Model=%s Kernel=%s Jobs=%d Cycles/job=%u Result=%s\n",
+                   model_names[model], kernel_names[kernel], WORKER_NB_JOBS, cycles,
+                   res.count ? "FAIL" : "SUCCESS");
+        }
+    }
+
+    // Stop the worker and wait for its task to end
+    job_t exit_job = {.kernel = KERNEL_EXIT};
+    job_push(&job_queue, &exit_job);
+    pi_task_wait_on(&worker_done);
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// Dispatch Overhead
+//=============================================================================
+static uint32_t dispatch_baseline;     // FC cycles of an empty cluster task, subtracted as Net=
+
+static void empty_entry(void *arg)
+{
+}
+
+// Fork the number of cores passed as argument on an empty function
+static void fork_entry(void *arg)
+{
+    pi_cl_team_fork((int)arg, empty_entry, NULL);
+}
+
+/**
+ * @brief FC cycles to send a task and get its completion back
+ * @return Minimum over DISPATCH_NB_RUNS runs, which filters out interrupts
+ *
+ * The task is set up before the counter starts, as in run_dma_test().
+ */
+static uint32_t measure_dispatch(void (*entry)(void *), void *arg)
+{
+    uint32_t best = 0xFFFFFFFF;
+
+    for (int r = 0; r < DISPATCH_NB_RUNS; r++)
+    {
+        struct pi_cluster_task task;
+        pi_cluster_task(&task, entry, arg);
+
+        pi_perf_conf(1 << PI_PERF_CYCLES);
+        pi_perf_reset();
+        pi_perf_start();
+        pi_cluster_send_task_to_cl(&cluster_dev, &task);
+        pi_perf_stop();
+
+        uint32_t cycles = pi_perf_read(PI_PERF_CYCLES);
+        if (cycles < best)
+            best = cycles;
+    }
+    return best;
+}
+
+static inline uint32_t net_cycles(uint32_t cycles)
+{
+    return cycles > dispatch_baseline ? cycles - dispatch_baseline : 0;
+}
+
+// Measure the empty-task baseline and, with DISPATCH_BENCH, the latency of
+// closing and reopening the cluster and of forking 1..CL_NB_CORES cores.
+// Must run before the L1 arena is reserved: closing the cluster drops L1.
+static int dispatch_bench(struct pi_cluster_conf *conf)
+{
+    dispatch_baseline = measure_dispatch(empty_entry, NULL);
+    printf("Dispatch baseline: %u cycles (empty task, min of %d)\n",
+           dispatch_baseline, DISPATCH_NB_RUNS);
+
+    if (!DISPATCH_BENCH)
+        return 0;
+
+    uint32_t open_best = 0xFFFFFFFF, close_best = 0xFFFFFFFF;
+    for (int r = 0; r < DISPATCH_NB_RUNS; r++)
+    {
+        pi_perf_conf(1 << PI_PERF_CYCLES);
+        pi_perf_reset();
+        pi_perf_start();
+        pi_cluster_close(&cluster_dev);
+        pi_perf_stop();
+        uint32_t close_cycles = pi_perf_read(PI_PERF_CYCLES);
+
+        pi_open_from_conf(&cluster_dev, conf);
+        pi_perf_reset();
+        pi_perf_start();
+        int err = pi_cluster_open(&cluster_dev);
+        pi_perf_stop();
+        uint32_t open_cycles = pi_perf_read(PI_PERF_CYCLES);
+
+        if (err)
+        {
+            printf("Cluster reopen failed!\n");
+            return -1;
+        }
+        if (close_cycles < close_best)
+            close_best = close_cycles;
+        if (open_cycles < open_best)
+            open_best = open_cycles;
+    }
+    printf("Dispatch Open=%u Close=%u cycles\n", open_best, close_best);
+
+    for (int n = 1; n <= CL_NB_CORES; n *= 2)
+    {
+        uint32_t cycles = measure_dispatch(fork_entry, (void *)n);
+        printf("Dispatch Fork=%d Cycles=%u Net=%u\n", n, cycles, net_cycles(cycles));
+    }
+    return 0;
+}
+
+//=============================================================================
+// Multi-Cluster Scaling
+//=============================================================================
+/**
+ * @brief Partition the buffer over nb clusters and set up each partition
+ * @param devs  Open cluster devices; partition c takes L1 from *devs[c]
+ * @return 0 on success, -1 if an L1 allocation failed (allocations are undone)
+ *
+ * Partition c covers [c*size/nb, (c+1)*size/nb) of ext_buff0/ext_buff1 and
+ * runs the NB_COPY=2 NB_ITER=4 pipeline in the L1 of its own cluster.
+ */
+static int mc_setup(dma_test_t *tests, struct pi_device **devs, int nb)
+{
+    int part = BUFF_SIZE / nb;
+
+    for (int c = 0; c < nb; c++)
+    {
+        dma_test_t *test = &tests[c];
+        int first = part * c;
+
+        *test = (dma_test_t){
+            .nb_copy = 2, .nb_iter = 4, .profile = 1,
+            .size = c == nb - 1 ? BUFF_SIZE - first : part,
+        };
+        test->src   = ext_buff0 + first;
+        test->dst   = ext_buff1 + first;
+        test->loc   = pi_cl_l1_malloc(devs[c], test->size);
+        test->xfers = pi_cl_l1_malloc(devs[c], test->nb_copy * sizeof(dma_xfer_t));
+
+        if (!test->loc || !test->xfers)
+        {
+            if (test->loc)
+                pi_cl_l1_free(devs[c], test->loc, test->size);
+            while (--c >= 0)
+            {
+                pi_cl_l1_free(devs[c], tests[c].xfers, tests[c].nb_copy * sizeof(dma_xfer_t));
+                pi_cl_l1_free(devs[c], tests[c].loc, tests[c].size);
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Run the partitions, one after the other or all at once
+ * @return FC cycles from the first dispatch to the last completion
+ */
+static uint32_t mc_run(dma_test_t *tests, struct pi_device **devs, int nb, int concurrent)
+{
+    struct pi_cluster_task tasks[MC_MAX_CLUSTERS];
+    pi_task_t done[MC_MAX_CLUSTERS];
+
+    fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+    memset(ext_buff1, 0, BUFF_SIZE + BUFF_PAD);
+    for (int c = 0; c < nb; c++)
+        reset_dma_results(&tests[c]);
+
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+
+    for (int c = 0; c < nb; c++)
+    {
+        pi_cluster_task(&tasks[c], cluster_entry, &tests[c]);
+        pi_cluster_send_task_to_cl_async(devs[c], &tasks[c], pi_task_block(&done[c]));
+        if (!concurrent)
+            pi_task_wait_on(&done[c]);
+    }
+    if (concurrent)
+        for (int c = 0; c < nb; c++)
+            pi_task_wait_on(&done[c]);
+
+    pi_perf_stop();
+    return pi_perf_read(PI_PERF_CYCLES);
+}
+
+// Open 1..NB_CLUSTERS clusters, split the buffer over them and compare each
+// cluster's DMA phase cycles alone and with all clusters sharing L2
+static int multi_cluster_sweep()
+{
+    struct pi_device extra_devs[MC_MAX_CLUSTERS];   // Clusters 1.. (entry 0 unused)
+    struct pi_device *devs[MC_MAX_CLUSTERS];
+    struct pi_cluster_conf confs[MC_MAX_CLUSTERS];
+    static dma_test_t tests[MC_MAX_CLUSTERS];   // Several live configurations: static (see dma_test_t)
+    uint32_t alone[MC_MAX_CLUSTERS];
+    int max = NB_CLUSTERS < MC_MAX_CLUSTERS ? NB_CLUSTERS : MC_MAX_CLUSTERS;
+    int nb_open = 1, errors = 0;
+
+    printf("Starting multi-cluster benchmark (1 to %d clusters, NB_COPY=2 NB_ITER=4)...\n", max);
+
+    // Cluster 0 is the already open cluster_dev; the others get their own id
+    devs[0] = &cluster_dev;
+    for (; nb_open < max; nb_open++)
+    {
+        devs[nb_open] = &extra_devs[nb_open];
+        pi_cluster_conf_init(&confs[nb_open]);
+        confs[nb_open].id = nb_open;
+        pi_open_from_conf(devs[nb_open], &confs[nb_open]);
+        if (pi_cluster_open(devs[nb_open]))
+        {
+            printf("Cluster %d open failed, scaling stops at %d clusters\n", nb_open, nb_open);
+            break;
+        }
+    }
+
+    // The arena of cluster 0 stays reserved; partitions take L1 next to it
+    for (int nb = 1; nb <= nb_open; nb++)
+    {
+        if (mc_setup(tests, devs, nb))
+        {
+            printf("Failed to allocate L1 buffer!\n");
+            errors++;
+            break;
+        }
+
+        // Each partition alone gives its uncontended DMA (read + write-back) cycles
+        mc_run(tests, devs, nb, 0);
+        for (int c = 0; c < nb; c++)
+            alone[c] = tests[c].phase_cycles[0] + tests[c].phase_cycles[2];
+
+        uint32_t cycles = mc_run(tests, devs, nb, 1);
+
+        verify_result_t res;
+        verify_scaled(ext_buff0, ext_buff1, BUFF_SIZE, 3, &res);
+        errors += res.count != 0;
+
+        // Aggregate bytes/cycle in hundredths, both directions
+        uint32_t bpc = cycles ? 2*BUFF_SIZE*100 / cycles : 0;
+        printf("Clusters=%d Cycles=%u Bytes/cycle=%u.%02u Result=%s\n",
+               nb, cycles, bpc / 100, bpc % 100, res.count ? "FAIL" : "SUCCESS");
+
+        for (int c = 0; c < nb; c++)
+        {
+            // Processing stays in L1, only the DMA phases see the shared L2
+            uint32_t shared = tests[c].phase_cycles[0] + tests[c].phase_cycles[2];
+            uint32_t slow = alone[c] ? shared*100 / alone[c] : 0;
+            printf("  Cluster=%d Size=%d DmaCycles=%u Alone=%u Slowdown=%u.%02ux ProcCycles=%u\n",
+                   c, tests[c].size, shared, alone[c], slow / 100, slow % 100,
+                   tests[c].phase_cycles[1]);
+        }
+
+        for (int c = nb - 1; c >= 0; c--)
+        {
+            pi_cl_l1_free(devs[c], tests[c].xfers, tests[c].nb_copy * sizeof(dma_xfer_t));
+            pi_cl_l1_free(devs[c], tests[c].loc, tests[c].size);
+        }
+    }
 
-/**
- * @brief Generate pseudo-random number using LCG algorithm
- * @return 31-bit pseudo-random number
- * 
- * Uses same parameters as glibc rand() for reproducible test data
- */
-static inline uint32_t my_rand()
-{
-    lcg_seed = (1103515245 * lcg_seed + 12345) & 0x7fffffff;
-    return lcg_seed;
+    for (int c = nb_open - 1; c > 0; c--)
+        pi_cluster_close(devs[c]);
+
+    return errors ? -1 : 0;
 }
 
-/*=============================================================================
- * CLUSTER PROCESSING FUNCTION
- *============================================================================*/
+//=============================================================================
+// Compile-Time Specialized Pipeline
+//=============================================================================
 /**
- * @brief Main cluster task that performs parameterized DMA transfers
- * @param arg Pointer to array containing [NB_COPY, NB_ITER] parameters
- * 
- * This function runs on the cluster and performs:
- * 1. Chunked DMA transfers from L2 to L1 (EXT2LOC)
- * 2. Simple data processing (multiply by 3) 
- * 3. Chunked DMA transfers from L1 back to L2 (LOC2EXT)
- * 
- * The chunking parameters control DMA granularity:
- * - NB_COPY: Number of DMA commands issued per iteration
- * - NB_ITER: Number of iterations to process entire buffer
- * - COPY_SIZE: Bytes transferred per DMA command
+ * @brief Plain DMA pipeline on the master core, shared by both variants
+ *
+ * Same work as cluster_entry() with the DMA policy, the contiguous layout
+ * and master-only processing, without profile, trace or tile checksums.
+ * Called with constants, chunk sizes, remainders and offsets fold at
+ * compile time and the DMA command and wait loops unroll; the processing
+ * loop is left as is. Called with test fields, it is the
+ * runtime-parameterized reference.
  */
-static void cluster_entry(void *arg)
+static inline __attribute__((always_inline))
+void spec_pipeline(dma_test_t *test, const int NB_COPY, const int NB_ITER, const int SIZE)
 {
-    // Extract DMA parameters from argument
-    int NB_COPY  = ((int*)arg)[0];   // Number of DMA copies per iteration
-    int NB_ITER  = ((int*)arg)[1];   // Number of iterations to complete buffer
-    
-    // Calculate chunk sizes based on parameters
-    int COPY_SIZE = BUFF_SIZE / NB_ITER / NB_COPY;  // Bytes per individual DMA transfer
-    int ITER_SIZE = BUFF_SIZE / NB_ITER;            // Bytes processed per iteration
+    const int COPY_SIZE = SIZE / NB_ITER / NB_COPY;
+    const int ITER_SIZE = SIZE / NB_ITER;
+    char *src = test->src, *dst = test->dst, *loc = test->loc;
+    dma_xfer_t *copy = test->xfers;
 
-    // Process buffer across multiple iterations
+    #pragma GCC unroll 8
     for (int j = 0; j < NB_ITER; j++)
     {
-        pi_cl_dma_cmd_t copy[NB_COPY];  // DMA command structures for this iteration
+        const int iter_len = (j == NB_ITER - 1) ? SIZE - ITER_SIZE*j : ITER_SIZE;
+        const int last_len = iter_len - COPY_SIZE*(NB_COPY - 1);
 
-        /*---------------------------------------------------------------------
-         * PHASE 1: Transfer data from L2 to L1 (EXT2LOC)
-         *--------------------------------------------------------------------*/
-        // Issue all DMA read commands for this iteration
+        #pragma GCC unroll 8
         for (int i = 0; i < NB_COPY; i++)
-            pi_cl_dma_cmd((int)ext_buff0 + COPY_SIZE*i + ITER_SIZE*j,  // L2 source address
-                          (int)loc_buff + COPY_SIZE*i + ITER_SIZE*j,   // L1 destination address
-                          COPY_SIZE, PI_CL_DMA_DIR_EXT2LOC, &copy[i]);
-
-        // Wait for all EXT2LOC transfers to complete before processing
+            pi_cl_dma_cmd((uint32_t)src + COPY_SIZE*i + ITER_SIZE*j,
+                          (uint32_t)loc + COPY_SIZE*i + ITER_SIZE*j,
+                          i == NB_COPY - 1 ? last_len : COPY_SIZE,
+                          PI_CL_DMA_DIR_EXT2LOC, &copy[i].cmd);
+        #pragma GCC unroll 8
         for (int i = 0; i < NB_COPY; i++)
-            pi_cl_dma_cmd_wait(&copy[i]);
+            pi_cl_dma_cmd_wait(&copy[i].cmd);
 
-        /*---------------------------------------------------------------------
-         * PHASE 2: Process data in fast L1 memory
-         *--------------------------------------------------------------------*/
-        // Optional processing: multiply each byte by 3 for verification
-        // This runs efficiently in L1 memory with low access latency
-        for (int i = 0; i < BUFF_SIZE; i++)
-            loc_buff[i] = loc_buff[i] * 3;
+        for (int i = 0; i < SIZE; i++)
+            loc[i] = loc[i] * 3;
 
-        /*---------------------------------------------------------------------
-         * PHASE 3: Transfer processed data from L1 back to L2 (LOC2EXT)
-         *--------------------------------------------------------------------*/
-        // Write back: Issue all DMA write commands for this iteration
+        #pragma GCC unroll 8
         for (int i = 0; i < NB_COPY; i++)
-            pi_cl_dma_cmd((int)ext_buff1 + COPY_SIZE*i + ITER_SIZE*j,  // L2 destination address
-                          (int)loc_buff + COPY_SIZE*i + ITER_SIZE*j,   // L1 source address
-                          COPY_SIZE, PI_CL_DMA_DIR_LOC2EXT, &copy[i]);
-
-        // Wait for all LOC2EXT transfers to complete before next iteration
+            pi_cl_dma_cmd((uint32_t)dst + COPY_SIZE*i + ITER_SIZE*j,
+                          (uint32_t)loc + COPY_SIZE*i + ITER_SIZE*j,
+                          i == NB_COPY - 1 ? last_len : COPY_SIZE,
+                          PI_CL_DMA_DIR_LOC2EXT, &copy[i].cmd);
+        #pragma GCC unroll 8
         for (int i = 0; i < NB_COPY; i++)
-            pi_cl_dma_cmd_wait(&copy[i]);
+            pi_cl_dma_cmd_wait(&copy[i].cmd);
     }
 }
 
-/*=============================================================================
- * INDIVIDUAL TEST EXECUTION
- *============================================================================*/
+// Runtime-parameterized reference: same body, parameters read from the test
+static void spec_runtime_entry(void *arg)
+{
+    dma_test_t *test = (dma_test_t *)arg;
+    spec_pipeline(test, test->nb_copy, test->nb_iter, test->size);
+}
+
+// One task body per SPEC_CONFIGS entry, all parameters constant
+#define SPEC_DEFINE(C, I)                                       \
+    static void spec_entry_##C##_##I(void *arg)                 \
+    {                                                           \
+        spec_pipeline((dma_test_t *)arg, C, I, BUFF_SIZE);      \
+    }
+SPEC_CONFIGS(SPEC_DEFINE)
+#undef SPEC_DEFINE
+
 /**
- * @brief Execute DMA test for a specific parameter combination
- * @param nb_copy Number of DMA transfers per iteration
- * @param nb_iter Number of iterations to complete the buffer
- * @return 0 on success, -1 on failure
- * 
- * This function:
- * 1. Allocates L1 memory and initializes test data
- * 2. Configures and runs the cluster task with specified parameters
- * 3. Measures execution time in cycles
- * 4. Verifies data correctness
- * 5. Reports results and cleans up resources
+ * @brief Entry of the lookup table of specialized pipelines
  */
-static int run_dma_test(int nb_copy, int nb_iter)
+typedef struct
 {
-    /*-------------------------------------------------------------------------
-     * MEMORY ALLOCATION
-     *------------------------------------------------------------------------*/
-    // Allocate buffer in L1 cluster memory (fast TCDM)
-    loc_buff = pmsis_l1_malloc(BUFF_SIZE);
-    if (!loc_buff)
-    {
-        printf("Failed to allocate L1 buffer!\n");
-        return -1;
-    }
+    int nb_copy;
+    int nb_iter;
+    void (*entry)(void *);
+} spec_variant_t;
 
-    /*-------------------------------------------------------------------------
-     * TEST DATA INITIALIZATION  
-     *------------------------------------------------------------------------*/
-    // Fill external buffer with pseudo-random data for testing
-    for (int i = 0; i < BUFF_SIZE; i++)
-        ext_buff0[i] = my_rand() & 0xFF;
+#define SPEC_ENTRY(C, I) {C, I, spec_entry_##C##_##I},
+static const spec_variant_t spec_variants[] = { SPEC_CONFIGS(SPEC_ENTRY) };
+#undef SPEC_ENTRY
 
-    /*-------------------------------------------------------------------------
-     * CLUSTER SETUP AND CONFIGURATION
-     *------------------------------------------------------------------------*/
-    struct pi_device cluster_dev;
-    struct pi_cluster_conf conf;
-    struct pi_cluster_task cluster_task;
+/**
+ * @brief Specialized task body for a configuration
+ * @return NULL when the configuration is not in SPEC_CONFIGS or the size
+ *         is not BUFF_SIZE
+ */
+static void (*spec_lookup(int nb_copy, int nb_iter, int size))(void *)
+{
+    if (size != BUFF_SIZE)
+        return NULL;
+    for (int v = 0; v < sizeof(spec_variants)/sizeof(spec_variants[0]); v++)
+        if (spec_variants[v].nb_copy == nb_copy && spec_variants[v].nb_iter == nb_iter)
+            return spec_variants[v].entry;
+    return NULL;
+}
 
-    // Initialize cluster with default configuration
-    pi_cluster_conf_init(&conf);
-    pi_open_from_conf(&cluster_dev, &conf);
+// Run every configuration of the main sweep through cluster_entry, the
+// runtime-parameterized plain pipeline and, when it was built, its
+// specialized variant. Runtime - Specialized is the cost of reading the
+// parameters at run time; Generic - Runtime that of the options cluster_entry
+// supports (policies, layouts, profile, trace).
+static int specialize_sweep()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int nb_variants = sizeof(spec_variants)/sizeof(spec_variants[0]);
+    int errors = 0;
 
-    // Open cluster device
-    if (pi_cluster_open(&cluster_dev))
+    printf("Starting specialized pipeline sweep (%d variants built)...\n", nb_variants);
+
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+        {
+            void (*entries[3])(void *) = {
+                NULL, spec_runtime_entry,   // NULL: cluster_entry with the global options
+                spec_lookup(nb_copy_values[i], nb_iter_values[j], BUFF_SIZE),
+            };
+            uint32_t cycles[3] = {0};
+            int failed = 0;
+
+            for (int e = 0; e < (entries[2] ? 3 : 2); e++)
+            {
+                dma_test_t test = {
+                    .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                    .size = BUFF_SIZE, .entry = entries[e],
+                };
+                failed |= run_dma_test(&test) != 0;
+                cycles[e] = test.cycles;
+            }
+            errors += failed;
+
+            if (entries[2])
+            {
+                // Tenths of a percent; the sign is printed apart so -0.9..-0.1 keep it
+                int saved = cycles[1] ? ((int)cycles[1] - (int)cycles[2])*1000 / (int)cycles[1] : 0;
+                int abs_saved = saved < 0 ? -saved : saved;
+                printf("NB_COPY=%d NB_ITER=%d Generic=%u Runtime=%u Specialized=%u Saved=%s%d.%d%% Result=%s\n",
+                       nb_copy_values[i], nb_iter_values[j], cycles[0], cycles[1], cycles[2],
+                       saved < 0 ? "-" : "", abs_saved / 10, abs_saved % 10, failed ? "FAIL" : "SUCCESS");
+            }
+            else
+                printf("NB_COPY=%d NB_ITER=%d Generic=%u Runtime=%u Specialized=n/a Result=%s\n",
+                       nb_copy_values[i], nb_iter_values[j], cycles[0], cycles[1],
+                       failed ? "FAIL" : "SUCCESS");
+        }
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// DMA Issue Cost
+//=============================================================================
+typedef enum
+{
+    ISSUE_PMSIS_MUL = 0,    // pi_cl_dma_cmd, addresses recomputed with multiplications
+    ISSUE_PMSIS_INC = 1,    // pi_cl_dma_cmd, addresses stepped by pointer increments
+    ISSUE_HAL       = 2,    // dma_hal_memcpy (HAL, no driver bookkeeping), counted-down loop
+    ISSUE_NB_VARIANTS
+} issue_variant_e;
+
+static const char *issue_variant_names[ISSUE_NB_VARIANTS] = {"PMSIS_MUL", "PMSIS_INC", "HAL"};
+
+/**
+ * @brief One issue measurement: BUFF_SIZE from ext_buff0 to L1 in nb_copy commands
+ */
+typedef struct
+{
+    int nb_copy;                            // Commands issued
+    int nb_iter;                            // Always 1; read at run time like cluster_entry
+    char *loc;                              // L1 destination (arena)
+    pi_cl_dma_cmd_t cmds[ISSUE_MAX_COPY];  // PMSIS command structs
+    uint32_t issue[ISSUE_NB_VARIANTS];      // Smallest issue cycles over ISSUE_NB_RUNS
+    uint32_t wait[ISSUE_NB_VARIANTS];       // Wait cycles of the same run
+    int errors;                             // Runs whose L1 copy differed from ext_buff0
+} issue_bench_t;
+
+/**
+ * @brief Issue the commands of one run with the given variant
+ * @param ids Counter ids returned by dma_hal_memcpy (ISSUE_HAL)
+ *
+ * All three are plain C loops that differ in the call and the address
+ * arithmetic only; no hardware-loop form is forced, so the HAL row is
+ * the XFER_HAL issue cost, not a separate mechanism.
+ */
+static void issue_run(issue_bench_t *b, int variant, int *ids)
+{
+    int NB_COPY   = b->nb_copy;
+    int COPY_SIZE = BUFF_SIZE / b->nb_iter / NB_COPY;
+    int ITER_SIZE = BUFF_SIZE / b->nb_iter;
+    int j = b->nb_iter - 1;
+
+    if (variant == ISSUE_PMSIS_MUL)
     {
-        printf("Cluster open failed!\n");
-        return -1;
+        for (int i = 0; i < NB_COPY; i++)
+            pi_cl_dma_cmd((int)ext_buff0 + COPY_SIZE*i + ITER_SIZE*j,
+                          (int)b->loc + COPY_SIZE*i + ITER_SIZE*j,
+                          COPY_SIZE, PI_CL_DMA_DIR_EXT2LOC, &b->cmds[i]);
+    }
+    else if (variant == ISSUE_PMSIS_INC)
+    {
+        uint32_t ext = (uint32_t)ext_buff0 + ITER_SIZE*j, loc = (uint32_t)b->loc + ITER_SIZE*j;
+        pi_cl_dma_cmd_t *cmd = b->cmds;
+        for (int n = NB_COPY; n > 0; n--, ext += COPY_SIZE, loc += COPY_SIZE)
+            pi_cl_dma_cmd(ext, loc, COPY_SIZE, PI_CL_DMA_DIR_EXT2LOC, cmd++);
+    }
+    else
+    {
+        uint32_t ext = (uint32_t)ext_buff0 + ITER_SIZE*j, loc = (uint32_t)b->loc + ITER_SIZE*j;
+        for (int n = NB_COPY; n > 0; n--, ext += COPY_SIZE, loc += COPY_SIZE)
+            *ids++ = dma_hal_memcpy(ext, loc, COPY_SIZE, PI_CL_DMA_DIR_EXT2LOC);
     }
+}
 
-    /*-------------------------------------------------------------------------
-     * CLUSTER TASK SETUP
-     *------------------------------------------------------------------------*/
-    // Pass DMA parameters to cluster task
-    int args[2] = {nb_copy, nb_iter};
-    pi_cluster_task(&cluster_task, cluster_entry, args);
+/**
+ * @brief Wait for the commands of issue_run()
+ */
+static void issue_wait(issue_bench_t *b, int variant, const int *ids)
+{
+    if (variant == ISSUE_HAL)
+        for (int n = b->nb_copy; n > 0; n--)
+            dma_hal_wait(*ids++);
+    else
+        for (int i = 0; i < b->nb_copy; i++)
+            pi_cl_dma_cmd_wait(&b->cmds[i]);
+}
+
+// Master core only: every variant ISSUE_NB_RUNS times, issue and wait timed
+// separately with the running cycle counter
+static void issue_entry(void *arg)
+{
+    issue_bench_t *b = (issue_bench_t *)arg;
+    int ids[ISSUE_MAX_COPY];
 
-    /*-------------------------------------------------------------------------
-     * PERFORMANCE MEASUREMENT
-     *------------------------------------------------------------------------*/
-    // Performance measurement: configure cycle counter
     pi_perf_conf(1 << PI_PERF_CYCLES);
     pi_perf_reset();
     pi_perf_start();
 
-    // Execute the DMA test on cluster
-    pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
+    for (int v = 0; v < ISSUE_NB_VARIANTS; v++)
+    {
+        b->issue[v] = 0xFFFFFFFF;
+        for (int r = 0; r < ISSUE_NB_RUNS; r++)
+        {
+            memset(b->loc, 0, BUFF_SIZE);
+
+            uint32_t t0 = pi_perf_read(PI_PERF_CYCLES);
+            issue_run(b, v, ids);
+            uint32_t t1 = pi_perf_read(PI_PERF_CYCLES);
+            issue_wait(b, v, ids);
+            uint32_t t2 = pi_perf_read(PI_PERF_CYCLES);
+
+            if (t1 - t0 < b->issue[v])
+            {
+                b->issue[v] = t1 - t0;
+                b->wait[v]  = t2 - t1;
+            }
+            b->errors += memcmp(b->loc, ext_buff0, BUFF_SIZE) != 0;
+        }
+    }
 
-    // Stop performance measurement and read results
     pi_perf_stop();
-    uint32_t cycles = pi_perf_read(PI_PERF_CYCLES);
+}
 
-    /*-------------------------------------------------------------------------
-     * RESULT VERIFICATION
-     *------------------------------------------------------------------------*/
-    // Verify correctness: check if processing was applied correctly
-    int error = 0;
-    for (int i = 0; i < BUFF_SIZE; i++)
+// Report issue cycles per command of the PMSIS and HAL-path issue
+// loops for NB_COPY = 1..ISSUE_MAX_COPY, BUFF_SIZE in one iteration
+static int issue_bench()
+{
+    int errors = 0;
+
+    printf("Starting DMA issue benchmark (%d bytes, min of %d runs)...\n", BUFF_SIZE, ISSUE_NB_RUNS);
+
+    fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+    l1_arena_reset();
+    char *loc = l1_arena_alloc(BUFF_SIZE, 4);
+    if (!loc)
+    {
+        printf("Failed to allocate L1 buffer!\n");
+        return -1;
+    }
+
+    for (int nb_copy = 1; nb_copy <= ISSUE_MAX_COPY; nb_copy *= 2)
     {
-        // Expected result: original value * 3 (with 8-bit wraparound)
-        if (ext_buff1[i] != (char)((ext_buff0[i] * 3) & 0xFF))
+        issue_bench_t b = {.nb_copy = nb_copy, .nb_iter = 1, .loc = loc};
+        struct pi_cluster_task task;
+
+        pi_cluster_task(&task, issue_entry, &b);
+        pi_cluster_send_task_to_cl(&cluster_dev, &task);
+        errors += b.errors != 0;
+
+        // Cycles per command in tenths
+        printf("NB_COPY=%d Chunk=%d", nb_copy, BUFF_SIZE / nb_copy);
+        for (int v = 0; v < ISSUE_NB_VARIANTS; v++)
         {
-            error = 1;
-            break;  // Stop on first error for efficiency
+            uint32_t per_cmd = b.issue[v] * 10 / nb_copy;
+            printf(" %s=%u.%u", issue_variant_names[v], per_cmd / 10, per_cmd % 10);
         }
+        printf(" WaitHAL=%u WaitPMSIS=%u Result=%s\n", b.wait[ISSUE_HAL],
+               b.wait[ISSUE_PMSIS_INC], b.errors ? "FAIL" : "SUCCESS");
     }
 
-    /*-------------------------------------------------------------------------
-     * RESULTS REPORTING
-     *------------------------------------------------------------------------*/
-    // Print test results in consistent format for analysis
-    printf("NB_COPY=%d NB_ITER=%d Buffer=%d Cycles=%u Result=%s\n",
-           nb_copy, nb_iter, BUFF_SIZE, cycles, error ? "FAIL" : "SUCCESS");
+    return errors ? -1 : 0;
+}
 
-    /*-------------------------------------------------------------------------
-     * CLEANUP
-     *------------------------------------------------------------------------*/
-    // Close cluster device and free allocated memory
-    pi_cluster_close(&cluster_dev);
-    pmsis_l1_malloc_free(loc_buff, BUFF_SIZE);
+//=============================================================================
+// DMA HAL Path Check
+//=============================================================================
+#define HAL_GUARD      0xA5    // Fill byte around the destination, catches overruns
+#define HAL_WINDOW_PAD 4       // Guard bytes checked after each destination
 
-    return error ? -1 : 0;
+/**
+ * @brief L1 buffers of the directed HAL-path check
+ */
+typedef struct
+{
+    char *l1_src;       // Source of LOC2EXT transfers (copy of ext_buff0)
+    char *l1_dst;       // Destination of EXT2LOC transfers
+    char *snap;         // Destination window left by the HAL path
+    int cases;          // Transfers compared
+    int mismatches;     // Cases where the two paths left different windows
+    int wrong;          // Cases where the HAL path did not copy the source
+} hal_check_t;
+
+/**
+ * @brief Run one transfer through the HAL path or the PMSIS driver
+ */
+static void hal_check_copy(uint32_t ext, uint32_t loc, int size, pi_cl_dma_dir_e dir, int hal)
+{
+    if (hal)
+        dma_hal_wait(dma_hal_memcpy(ext, loc, size, dir));
+    else
+    {
+        pi_cl_dma_cmd_t cmd;
+        pi_cl_dma_cmd(ext, loc, size, dir, &cmd);
+        pi_cl_dma_cmd_wait(&cmd);
+    }
+}
+
+// Master core only: every size, source and destination word phase and
+// direction once through each path onto a guard-filled window, comparing
+// the windows byte for byte
+static void hal_check_entry(void *arg)
+{
+    hal_check_t *fc = (hal_check_t *)arg;
+    static const int sizes[] = {1, 2, 3, 4, 5, 7, 8, 15, 16, 63, 64, 255, 256, 1000, 1024, BUFF_SIZE};
+
+    memcpy(fc->l1_src, ext_buff0, BUFF_SIZE + BUFF_PAD);
+
+    for (int d = 0; d < 2; d++)
+        for (int n = 0; n < sizeof(sizes)/sizeof(int); n++)
+            for (int phase = 0; phase < 16; phase++)
+            {
+                pi_cl_dma_dir_e dir = d ? PI_CL_DMA_DIR_LOC2EXT : PI_CL_DMA_DIR_EXT2LOC;
+                int src_off = phase / 4, off = phase % 4;   // Source and destination phases
+                int size = sizes[n], window = off + size + HAL_WINDOW_PAD;
+                char *src = (d ? fc->l1_src : ext_buff0) + src_off;
+                char *dst = d ? ext_buff1 : fc->l1_dst;
+                uint32_t ext = (uint32_t)(d ? dst + off : src);
+                uint32_t loc = (uint32_t)(d ? src : dst + off);
+
+                for (int hal = 1; hal >= 0; hal--)
+                {
+                    memset(dst, HAL_GUARD, window);
+                    hal_check_copy(ext, loc, size, dir, hal);
+                    if (hal)
+                        memcpy(fc->snap, dst, window);
+                }
+
+                fc->cases++;
+                fc->mismatches += memcmp(fc->snap, dst, window) != 0;
+                fc->wrong += memcmp(fc->snap + off, src, size) != 0;
+            }
+}
+
+// Check the HAL path against pi_cl_dma_cmd on single transfers of every
+// size and word phase, then run the main sweep with XFER_HAL and XFER_DMA
+static int hal_path_test()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int errors = 0;
+
+    printf("Starting DMA HAL path check...\n");
+
+    fill_test_data(ext_buff0, BUFF_SIZE + BUFF_PAD, DATA_PATTERN);
+    l1_arena_reset();
+    hal_check_t fc = {
+        .l1_src = l1_arena_alloc(BUFF_SIZE + BUFF_PAD, 4),
+        .l1_dst = l1_arena_alloc(BUFF_SIZE + BUFF_PAD, 4),
+        .snap   = l1_arena_alloc(BUFF_SIZE + BUFF_PAD, 4),
+    };
+    if (!fc.l1_src || !fc.l1_dst || !fc.snap)
+    {
+        printf("Failed to allocate L1 buffer!\n");
+        return -1;
+    }
+
+    struct pi_cluster_task task;
+    pi_cluster_task(&task, hal_check_entry, &fc);
+    pi_cluster_send_task_to_cl(&cluster_dev, &task);
+    errors += fc.mismatches || fc.wrong;
+
+    printf("HAL path vs PMSIS: Cases=%d Mismatches=%d Wrong=%d Result=%s\n",
+           fc.cases, fc.mismatches, fc.wrong, fc.mismatches || fc.wrong ? "FAIL" : "SUCCESS");
+
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+        {
+            static dma_test_t pmsis, hal;    // Several live configurations: static (see dma_test_t)
+            pmsis = (dma_test_t){
+                .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                .size = BUFF_SIZE, .policy = XFER_DMA,
+            };
+            hal = pmsis;
+            hal.policy = XFER_HAL;
+
+            errors += run_dma_test(&pmsis) != 0;
+            errors += run_dma_test(&hal) != 0;
+
+            printf("NB_COPY=%d NB_ITER=%d PMSIS=%u Hal=%u Result=%s\n",
+                   pmsis.nb_copy, pmsis.nb_iter, pmsis.cycles, hal.cycles,
+                   pmsis.error || hal.error ? "FAIL" : "SUCCESS");
+        }
+
+    return errors ? -1 : 0;
+}
+
+//=============================================================================
+// Read/Write Interleaving
+//=============================================================================
+// Run the main configurations with the phased and the interleaved schedule.
+// Both process each chunk once (iter_proc for the phased one), so Cycles
+// compares the schedules on equal work; Dma= gives the master cycles
+// outside processing.
+static int schedule_sweep()
+{
+    int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
+    int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int errors = 0;
+
+    printf("Starting DMA schedule sweep (phased vs read/write interleaved)...\n");
+
+    for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
+        for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
+        {
+            static dma_test_t tests[SCHED_NB_MODES];   // Several live configurations: static (see dma_test_t)
+            uint32_t dma[SCHED_NB_MODES];
+
+            for (int m = 0; m < SCHED_NB_MODES; m++)
+            {
+                tests[m] = (dma_test_t){
+                    .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                    .size = BUFF_SIZE, .schedule = m, .iter_proc = 1, .profile = 1,
+                };
+                errors += run_dma_test(&tests[m]) != 0;
+                dma[m] = tests[m].phase_cycles[0] + tests[m].phase_cycles[2];
+            }
+
+            printf("NB_COPY=%d NB_ITER=%d %s=%u Dma=%u %s=%u Dma=%u Result=%s\n",
+                   nb_copy_values[i], nb_iter_values[j],
+                   dma_schedule_names[SCHED_PHASED], tests[SCHED_PHASED].cycles, dma[SCHED_PHASED],
+                   dma_schedule_names[SCHED_INTERLEAVED], tests[SCHED_INTERLEAVED].cycles,
+                   dma[SCHED_INTERLEAVED],
+                   tests[SCHED_PHASED].error || tests[SCHED_INTERLEAVED].error ? "FAIL" : "SUCCESS");
+        }
+
+    return errors ? -1 : 0;
 }
 
 //=============================================================================
@@ -234,18 +3917,126 @@ static int test_entry()
 {
     int nb_copy_values[] = {1, 2, 4, 8};  // DMA chunks per iteration
     int nb_iter_values[] = {1, 2, 4, 8};  // Iterations to complete buffer
+    int ret = 0;
+
+    /*-------------------------------------------------------------------------
+     * CLUSTER SETUP AND CONFIGURATION
+     *------------------------------------------------------------------------*/
+    struct pi_cluster_conf conf;
+
+    // Initialize cluster with default configuration
+    pi_cluster_conf_init(&conf);
+    pi_open_from_conf(&cluster_dev, &conf);
+
+    // Open cluster device once; every configuration reuses it
+    if (pi_cluster_open(&cluster_dev))
+    {
+        printf("Cluster open failed!\n");
+        return -1;
+    }
+
+    // Dispatch cost, subtracted from the main sweep as Net=
+    if (dispatch_bench(&conf))
+    {
+        pi_cluster_close(&cluster_dev);
+        return -1;
+    }
+
+    // Single L1 reservation shared by all configurations
+    if (l1_arena_init(L1_ARENA_SIZE))
+    {
+        printf("Failed to reserve %d bytes of L1!\n", L1_ARENA_SIZE);
+        pi_cluster_close(&cluster_dev);
+        return -1;
+    }
 
     printf("Starting DMA parameter sweep tests...\n");
+    printf("Test data: %s, filled by %s\n", data_pattern_names[DATA_PATTERN],
+           DATA_FILL_CLUSTER ? "cluster" : "FC");
+
+    // Results per configuration (index i*nb_iters + j) and the best ones by cycles
+    // and by estimated energy (ENERGY_ESTIMATE), -1 while none passed
+    int nb_iters = sizeof(nb_iter_values)/sizeof(int);
+    uint32_t cycles[16], energy_pj[16];
+    int best_cycles = -1, best_energy = -1;
 
     // Test all combinations (4 × 4 = 16 configurations)
     for (int i = 0; i < sizeof(nb_copy_values)/sizeof(int); i++)
     {
         for (int j = 0; j < sizeof(nb_iter_values)/sizeof(int); j++)
         {
-            run_dma_test(nb_copy_values[i], nb_iter_values[j]);
+            dma_test_t test = {
+                .nb_copy = nb_copy_values[i], .nb_iter = nb_iter_values[j],
+                .size = BUFF_SIZE,
+            };
+            run_dma_test(&test);
+
+            // Print test results in consistent format for analysis
+            printf("NB_COPY=%d NB_ITER=%d Buffer=%d Cycles=%u Result=%s Net=%u\n",
+                   test.nb_copy, test.nb_iter, test.size, test.cycles,
+                   test.error ? "FAIL" : "SUCCESS", net_cycles(test.cycles));
+            report_details(&test);
+
+            int k = i*nb_iters + j;
+            cycles[k]    = test.cycles;
+            energy_pj[k] = test.energy_pj;
+            if (!test.error && (best_cycles < 0 || cycles[k] < cycles[best_cycles]))
+                best_cycles = k;
+            if (!test.error && test.energy && (best_energy < 0 || energy_pj[k] < energy_pj[best_energy]))
+                best_energy = k;
         }
     }
-    return 0;
+
+    if (ENERGY_ESTIMATE && best_energy >= 0)
+    {
+        printf("Cycle-optimal:  NB_COPY=%d NB_ITER=%d Cycles=%u E=%u pJ\n",
+               nb_copy_values[best_cycles / nb_iters], nb_iter_values[best_cycles % nb_iters],
+               cycles[best_cycles], energy_pj[best_cycles]);
+        printf("Energy-optimal: NB_COPY=%d NB_ITER=%d Cycles=%u E=%u pJ\n",
+               nb_copy_values[best_energy / nb_iters], nb_iter_values[best_energy % nb_iters],
+               cycles[best_energy], energy_pj[best_energy]);
+    }
+
+    // Optional sweeps selected at compile time
+    if (ALIGN_SWEEP)
+        ret |= align_sweep();
+    if (LAYOUT_SWEEP)
+        ret |= layout_sweep();
+    if (CPU_BASELINE)
+        ret |= cpu_baseline_sweep();
+    if (HYBRID_SWEEP)
+        ret |= hybrid_sweep();
+    if (COPY_PATH_SWEEP)
+        ret |= copy_path_sweep();
+#if L3_STAGING
+    ret |= l3_staging_sweep();
+#endif
+#if CONTENTION_SWEEP
+    ret |= contention_sweep();
+#endif
+    if (ASYNC_SWEEP)
+        ret |= async_sweep();
+    if (WORKER_SWEEP)
+        ret |= worker_sweep();
+    if (NB_CLUSTERS > 1)
+        ret |= multi_cluster_sweep();
+    if (SPECIALIZE_SWEEP)
+        ret |= specialize_sweep();
+    if (ISSUE_BENCH)
+        ret |= issue_bench();
+    if (HAL_PATH_TEST)
+        ret |= hal_path_test();
+    if (SCHEDULE_SWEEP)
+        ret |= schedule_sweep();
+
+    /*-------------------------------------------------------------------------
+     * CLEANUP
+     *------------------------------------------------------------------------*/
+    // Free the L1 reservation and close cluster device
+    l1_arena_release();
+    pi_cluster_close(&cluster_dev);
+
+    return ret;
 }
 
 //=============================================================================
@@ -10,8 +10,8 @@
  * - L2 Memory: External memory accessible by fabric controller
  * - L1 Memory: Fast cluster-local memory (TCDM - Tightly Coupled Data Memory)
  * 
- * Test Flow:
- * 1. Initialize source buffer in L2 with pseudo-random data
+ * Test Flow (repeated for every size from MIN_SIZE to BUFF_SIZE):
+ * 1. Initialize source buffer in L2 with test data (pseudo-random by default)
  * 2. Transfer data from L2 to L1 in chunks using DMA
  * 3. Process data in L1 (multiply by 3)
  * 4. Transfer processed data back to L2 using DMA
@@ -25,44 +25,218 @@
 /*=============================================================================
  * CONFIGURATION PARAMETERS
  *============================================================================*/
-#define BUFF_SIZE 2048       /**< Total buffer size in bytes - increased for parameter sweep */
+#ifndef BUFF_SIZE
+#define BUFF_SIZE 32768      /**< Largest swept buffer size, bounded by the L1 space for loc_buff */
+#endif
+#define MIN_SIZE  64         /**< Smallest swept buffer size */
 #define NB_COPY   2          /**< Number of DMA chunks per iteration */
 #define NB_ITER   4          /**< Number of iterations to process entire buffer */
-#define COPY_SIZE (BUFF_SIZE/NB_ITER/NB_COPY)  /**< Size of each DMA chunk (128 bytes) */
-#define ITER_SIZE (BUFF_SIZE/NB_ITER)          /**< Size processed per iteration (256 bytes) */
+
+#define CLOCK_FREQ_FALLBACK_HZ 50000000  /**< Clock assumed when the runtime reports no frequency */
+/* FC_FREQ_HZ / CL_FREQ_HZ, when defined, replace the FC / cluster frequency reported by
+ * the runtime; CLOCK_FREQ_HZ sets both */
+#if defined(CLOCK_FREQ_HZ) && !defined(FC_FREQ_HZ)
+#define FC_FREQ_HZ CLOCK_FREQ_HZ
+#endif
+#if defined(CLOCK_FREQ_HZ) && !defined(CL_FREQ_HZ)
+#define CL_FREQ_HZ CLOCK_FREQ_HZ
+#endif
+
+#ifndef FREQ_SWEEP
+#define FREQ_SWEEP 0         /**< 1: repeat the size sweep at every CL_FREQ_LIST cluster frequency */
+#endif
+#ifndef CL_FREQ_LIST
+#define CL_FREQ_LIST 50000000, 100000000, 175000000  /**< Cluster frequencies (Hz) of FREQ_SWEEP */
+#endif
+
+#ifndef DATA_PATTERN
+#define DATA_PATTERN 0       /**< Source data: 0 random, 1 increment, 2 zero, 3 ones, 4 walking bit */
+#endif
 
 /*=============================================================================
  * GLOBAL MEMORY BUFFERS
  *============================================================================*/
-static char ext_buff0[BUFF_SIZE];   /**< Source buffer in L2 external memory */
-static char ext_buff1[BUFF_SIZE];   /**< Destination buffer in L2 external memory */
+static char ext_buff0[BUFF_SIZE] __attribute__((aligned(8)));   /**< Source buffer in L2 external memory */
+static char ext_buff1[BUFF_SIZE] __attribute__((aligned(8)));   /**< Destination buffer in L2 external memory */
 static char *loc_buff;              /**< Processing buffer in L1 cluster memory */
 
 /*=============================================================================
- * PSEUDO-RANDOM NUMBER GENERATOR
+ * TEST DATA GENERATOR
  *============================================================================*/
-static uint32_t lcg_seed = 1;       /**< Seed for Linear Congruential Generator */
+/**
+ * @brief Content written to the source buffer
+ */
+typedef enum {
+    DATA_RANDOM      = 0,   /**< LCG words */
+    DATA_INCREMENT   = 1,   /**< Byte i holds i & 0xFF */
+    DATA_ZERO        = 2,   /**< All bytes 0x00 */
+    DATA_ONES        = 3,   /**< All bytes 0xFF */
+    DATA_WALKING_BIT = 4,   /**< Word i holds 1 << (i % 32) */
+    DATA_NB_PATTERNS
+} data_pattern_e;
+
+static const char *data_pattern_names[DATA_NB_PATTERNS] = {
+    "random", "incrementing", "all-zero", "all-ones", "walking-bit"
+};
+
+#define GEN_LCG_A 1664525u      /**< 32-bit LCG multiplier (Numerical Recipes) */
+#define GEN_LCG_C 1013904223u   /**< 32-bit LCG increment */
+
+/**
+ * @brief Advance the generator by one step and return a 32-bit word
+ * @param state Generator state, updated in place
+ * @return Pseudo-random word
+ *
+ * Formula: next = (a * state + c) mod 2^32. The low bits of a power-of-two
+ * modulus LCG have short periods, so the high half is folded into the output.
+ */
+static inline uint32_t gen_next(uint32_t *state)
+{
+    uint32_t x = *state = GEN_LCG_A * *state + GEN_LCG_C;
+    return x ^ (x >> 16);
+}
 
 /**
- * @brief Simple pseudo-random number generator using Linear Congruential Generator
- * @return 31-bit pseudo-random number
+ * @brief Fill the first nb_words words of buf with a pattern
+ * @param buf      Word-aligned buffer
+ * @param nb_words Number of words to fill
+ * @param pattern  One of data_pattern_e
+ * @param seed     Generator state at word 0
+ */
+static void gen_fill(uint32_t *buf, int nb_words, int pattern, uint32_t seed)
+{
+    uint32_t state = seed;
+
+    for (int w = 0; w < nb_words; w++) {
+        switch (pattern) {
+            case DATA_RANDOM:      buf[w] = gen_next(&state); break;
+            case DATA_INCREMENT:   buf[w] = ((4*w) & 0xFF) * 0x01010101u + 0x03020100u; break;
+            case DATA_ZERO:        buf[w] = 0; break;
+            case DATA_ONES:        buf[w] = 0xFFFFFFFFu; break;
+            case DATA_WALKING_BIT: buf[w] = 1u << (w & 31); break;
+        }
+    }
+}
+
+/*=============================================================================
+ * RESULT VERIFICATION
+ *============================================================================*/
+/**
+ * @brief Outcome of a verification pass
+ */
+typedef struct {
+    int first;          /**< Index of the first wrong byte, -1 if none */
+    int count;          /**< Number of wrong bytes */
+} verify_result_t;
+
+/**
+ * @brief Multiply each byte of a word by 3 (8-bit wraparound per byte)
+ * @param w Four source bytes
+ * @return Four expected result bytes
  * 
- * Uses the same parameters as glibc's rand() function for reproducible results.
- * Formula: next = (a * seed + c) mod m
- * Where: a = 1103515245, c = 12345, m = 2^31
+ * 2*x is a shift with the bit carried into the next byte masked off; the
+ * byte-wise add then keeps carries from crossing byte boundaries by adding
+ * the low 7 bits and patching the top bit in with an XOR.
  */
-static inline uint32_t my_rand(void)
+static inline uint32_t swar_mul3(uint32_t w)
 {
-    lcg_seed = (1103515245 * lcg_seed + 12345) & 0x7fffffff;
-    return lcg_seed;
+    uint32_t two = (w << 1) & 0xFEFEFEFE;
+    return ((w & 0x7F7F7F7F) + (two & 0x7F7F7F7F)) ^ ((w ^ two) & 0x80808080);
+}
+
+/**
+ * @brief Count a wrong byte in a verification result
+ */
+static inline void verify_mismatch(verify_result_t *res, int index)
+{
+    if (res->first < 0) {
+        res->first = index;
+    }
+    res->count++;
+}
+
+/**
+ * @brief Check dst[i] == (src[i] * 3) & 0xFF over size bytes
+ * @param src  Source buffer
+ * @param dst  Processed buffer
+ * @param size Number of bytes to check
+ * @param res  First mismatch and total count
+ * 
+ * Compares whole words against SWAR-computed expected values and only scans
+ * bytes inside a word that differs. Buffers whose word phase differs are
+ * checked byte by byte.
+ */
+static void verify_mul3(const char *src, const char *dst, int size, verify_result_t *res)
+{
+    int i = 0;
+    res->first = -1;
+    res->count = 0;
+    
+    if (!(((uint32_t)src ^ (uint32_t)dst) & 3)) {
+        // Bytes up to the first word boundary
+        for (; i < size && ((uint32_t)(src + i) & 3); i++) {
+            if (dst[i] != (char)(src[i] * 3)) {
+                verify_mismatch(res, i);
+            }
+        }
+        
+        // Whole words, scanning bytes only inside a differing word
+        for (; i + 4 <= size; i += 4) {
+            uint32_t expected = swar_mul3(*(const uint32_t *)(src + i));
+            if (*(const uint32_t *)(dst + i) == expected) {
+                continue;
+            }
+            for (int k = i; k < i + 4; k++) {
+                if (dst[k] != (char)(src[k] * 3)) {
+                    verify_mismatch(res, k);
+                }
+            }
+        }
+    }
+    
+    // Remaining bytes (or everything when the word phases differ)
+    for (; i < size; i++) {
+        if (dst[i] != (char)(src[i] * 3)) {
+            verify_mismatch(res, i);
+        }
+    }
 }
 
 /*=============================================================================
  * CLUSTER PROCESSING FUNCTION
  *============================================================================*/
+/**
+ * @brief One point of the throughput curve
+ */
+typedef struct {
+    int size;           /**< Bytes moved L2 -> L1 -> L2 */
+    uint32_t cycles;    /**< FC cycles around the cluster task */
+    uint32_t cl_cycles; /**< Cluster cycles inside cluster_entry */
+    int errors;         /**< Wrong bytes in the result */
+} size_test_t;
+
+/**
+ * @brief Length of chunk i of iteration j
+ * @param size Total buffer size
+ * @param i    Chunk index within the iteration
+ * @param j    Iteration index
+ * @return Chunk length in bytes
+ * 
+ * Sizes that do not divide evenly leave a remainder: the last iteration
+ * takes the bytes left over by the iterations, and the last chunk of each
+ * iteration the bytes left over by the chunks.
+ */
+static inline int chunk_len(int size, int i, int j)
+{
+    int iter_size = size / NB_ITER;
+    int copy_size = iter_size / NB_COPY;
+    int iter_len  = (j == NB_ITER - 1) ? size - iter_size * j : iter_size;
+    return (i == NB_COPY - 1) ? iter_len - copy_size * (NB_COPY - 1) : copy_size;
+}
+
 /**
  * @brief Main cluster task performing DMA transfers and data processing
- * @param arg Unused parameter (required by cluster task interface)
+ * @param arg Pointer to the size_test_t being measured
  * 
  * This function runs on the cluster and performs:
  * 1. Chunked DMA transfers from L2 to L1 (EXT2LOC)
@@ -74,6 +248,16 @@ static inline uint32_t my_rand(void)
  */
 static void cluster_entry(void *arg)
 {
+    size_test_t *test   = (size_test_t *)arg;
+    const int SIZE      = test->size;
+    const int ITER_SIZE = SIZE / NB_ITER;      /**< Size processed per iteration */
+    const int COPY_SIZE = ITER_SIZE / NB_COPY; /**< Size of each DMA chunk */
+    
+    // Cluster clock cycles, without the dispatch counted by the FC
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+    
     // Process buffer in multiple iterations
     for (int j = 0; j < NB_ITER; j++)
     {
@@ -92,7 +276,7 @@ static void cluster_entry(void *arg)
             pi_cl_dma_cmd(
                 src_addr,                    // Source address in L2
                 dst_addr,                    // Destination address in L1  
-                COPY_SIZE,                   // Transfer size
+                chunk_len(SIZE, i, j),       // Transfer size
                 PI_CL_DMA_DIR_EXT2LOC,      // Direction: External to Local
                 &copy[i]                     // Command structure to track transfer
             );
@@ -108,7 +292,7 @@ static void cluster_entry(void *arg)
          *--------------------------------------------------------------------*/
         // Simple processing: multiply each byte by 3
         // This runs efficiently in L1 memory with low latency access
-        for (int i = 0; i < BUFF_SIZE; i++) {
+        for (int i = 0; i < SIZE; i++) {
             loc_buff[i] = (char)(loc_buff[i] * 3);
         }
         
@@ -125,7 +309,7 @@ static void cluster_entry(void *arg)
             pi_cl_dma_cmd(
                 dst_addr,                    // Destination address in L2
                 src_addr,                    // Source address in L1
-                COPY_SIZE,                   // Transfer size
+                chunk_len(SIZE, i, j),       // Transfer size
                 PI_CL_DMA_DIR_LOC2EXT,      // Direction: Local to External
                 &copy[i]                     // Command structure to track transfer
             );
@@ -136,36 +320,183 @@ static void cluster_entry(void *arg)
             pi_cl_dma_cmd_wait(&copy[i]);
         }
     }
+    
+    pi_perf_stop();
+    test->cl_cycles = pi_perf_read(PI_PERF_CYCLES);
 }
 
 /*=============================================================================
  * TEST EXECUTION AND VERIFICATION
  *============================================================================*/
+/**
+ * @brief Measure and verify one buffer size
+ * @param cluster_dev Open cluster device
+ * @param test        Size to run; cycles and errors are filled in
+ * @return 0 on success, -1 on failure
+ */
+static int run_size(struct pi_device *cluster_dev, size_test_t *test)
+{
+    struct pi_cluster_task cluster_task;
+    
+    // Clear destination buffer to ensure clean test
+    for (int i = 0; i < test->size; i++) {
+        ext_buff1[i] = 0;
+    }
+    
+    /*-------------------------------------------------------------------------
+     * PERFORMANCE MEASUREMENT
+     *------------------------------------------------------------------------*/
+    // Configure performance counter to measure cycles
+    pi_perf_conf(1 << PI_PERF_CYCLES);
+    pi_perf_reset();
+    pi_perf_start();
+    
+    // Send task to cluster and wait for completion
+    pi_cluster_task(&cluster_task, cluster_entry, test);
+    pi_cluster_send_task_to_cl(cluster_dev, &cluster_task);
+    
+    pi_perf_stop();
+    test->cycles = pi_perf_read(PI_PERF_CYCLES);
+    
+    /*-------------------------------------------------------------------------
+     * RESULT VERIFICATION
+     *------------------------------------------------------------------------*/
+    verify_result_t verify;
+    verify_mul3(ext_buff0, ext_buff1, test->size, &verify);
+    test->errors = verify.count;
+    
+    if (verify.count) {
+        int i = verify.first;
+        char expected = (char)((ext_buff0[i] * 3) & 0xFF);
+        printf("ERROR at index %d: expected 0x%02x, got 0x%02x (source: 0x%02x), "
+               "%d of %d bytes wrong\n",
+               i, expected & 0xFF, ext_buff1[i] & 0xFF, ext_buff0[i] & 0xFF,
+               verify.count, test->size);
+    }
+    return verify.count ? -1 : 0;
+}
+
+/**
+ * @brief Current frequency of a clock domain
+ * @param domain PI_FREQ_DOMAIN_FC or PI_FREQ_DOMAIN_CL
+ * @return FC_FREQ_HZ / CL_FREQ_HZ for its domain if defined, else the
+ *         frequency reported by the runtime in Hz, CLOCK_FREQ_FALLBACK_HZ if
+ *         it reports none
+ */
+static uint32_t clock_freq(pi_freq_domain_e domain)
+{
+    uint32_t freq = pi_freq_get(domain);
+#ifdef FC_FREQ_HZ
+    if (domain == PI_FREQ_DOMAIN_FC)
+        freq = FC_FREQ_HZ;
+#endif
+#ifdef CL_FREQ_HZ
+    if (domain == PI_FREQ_DOMAIN_CL)
+        freq = CL_FREQ_HZ;
+#endif
+    return freq ? freq : CLOCK_FREQ_FALLBACK_HZ;
+}
+
+/**
+ * @brief Run, verify and report every buffer size at the current clocks
+ * @param cluster_dev Open cluster device
+ * @param cl_set      Cluster frequency just set by freq_sweep(), 0 at the
+ *                    default clocks (clock_freq(), CL_FREQ_HZ applies)
+ * @return 0 if every size passed, -1 otherwise
+ * 
+ * MB/s is wall-time throughput: FC cycles at the FC frequency include the
+ * task dispatch. ClMB/s uses the cluster cycles at the cluster frequency
+ * and only covers the transfers and processing.
+ */
+static int sweep_sizes(struct pi_device *cluster_dev, uint32_t cl_set)
+{
+    uint32_t fc_freq = clock_freq(PI_FREQ_DOMAIN_FC);
+    uint32_t cl_freq = cl_set ? cl_set : clock_freq(PI_FREQ_DOMAIN_CL);
+    int failed = 0;
+    
+    printf("Clock frequencies: FC %u Hz, cluster %u Hz\n", fc_freq, cl_freq);
+#if defined(FC_FREQ_HZ) || defined(CL_FREQ_HZ)
+    printf("Frequency override, runtime reports FC %u Hz, cluster %u Hz\n",
+           pi_freq_get(PI_FREQ_DOMAIN_FC), pi_freq_get(PI_FREQ_DOMAIN_CL));
+#endif
+    
+    // Every power of two and a non-power (1.5x, minus 3 so that chunks and
+    // iterations do not divide it evenly) in between
+    for (int pow2 = MIN_SIZE; pow2 <= BUFF_SIZE; pow2 *= 2) {
+        int sizes[2] = { pow2, pow2 + pow2 / 2 - 3 };
+        
+        for (int k = 0; k < 2 && sizes[k] <= BUFF_SIZE; k++) {
+            size_test_t test = { .size = sizes[k] };
+            failed |= run_size(cluster_dev, &test);
+            
+            // Read + write: every byte crosses the L2/L1 boundary twice
+            uint32_t total_transfers = test.size * 2;
+            float bytes_per_cycle = (float)total_transfers / test.cycles;
+            float mb_per_s    = bytes_per_cycle * fc_freq / 1e6f;
+            float cl_mb_per_s = (float)total_transfers / test.cl_cycles * cl_freq / 1e6f;
+            
+            printf("Size=%d Cycles=%u Bytes/cycle=%.3f Cycles/byte=%.2f MB/s=%.2f "
+                   "ClCycles=%u ClMB/s=%.2f Result=%s\n",
+                   test.size, test.cycles, bytes_per_cycle, 1.0f / bytes_per_cycle,
+                   mb_per_s, test.cl_cycles, cl_mb_per_s, test.errors ? "FAILED" : "SUCCESS");
+        }
+    }
+    return failed;
+}
+
+/**
+ * @brief Repeat the size sweep at every cluster frequency of CL_FREQ_LIST
+ * @param cluster_dev Open cluster device
+ * @return 0 if every size passed at every frequency, -1 otherwise
+ * 
+ * The FC and L2 keep their clock, so the ratio between cluster and FC
+ * cycles shows how much of a transfer is bound by the L2 side.
+ */
+static int freq_sweep(struct pi_device *cluster_dev)
+{
+    static const uint32_t cl_freqs[] = { CL_FREQ_LIST };
+    uint32_t cl_freq = pi_freq_get(PI_FREQ_DOMAIN_CL);
+    int failed = 0;
+    
+    for (int f = 0; f < sizeof(cl_freqs) / sizeof(cl_freqs[0]); f++) {
+        printf("--- Cluster frequency %u Hz ---\n", cl_freqs[f]);
+        if (pi_freq_set(PI_FREQ_DOMAIN_CL, cl_freqs[f])) {
+            printf("WARNING: cluster frequency %u Hz not supported, skipped\n", cl_freqs[f]);
+            continue;
+        }
+        failed |= sweep_sizes(cluster_dev, cl_freqs[f]);
+    }
+    
+    // Restore the frequency the application started with
+    if (cl_freq) {
+        pi_freq_set(PI_FREQ_DOMAIN_CL, cl_freq);
+    }
+    return failed;
+}
+
 /**
  * @brief Main test function that orchestrates the DMA test
  * @return 0 on success, -1 on failure
  * 
  * This function:
  * 1. Initializes and configures the cluster
- * 2. Allocates L1 memory buffer
+ * 2. Allocates L1 memory buffer for the largest size
  * 3. Initializes test data
- * 4. Executes the cluster task with performance monitoring
- * 5. Verifies results and reports performance
+ * 4. Measures and verifies every size of the sweep
+ * 5. Reports bytes/cycle and MB/s at the configured clock frequencies
  */
 static int test_entry(void)
 {
     printf("=== PULP DMA Transfer Test ===\n");
-    printf("Buffer size: %d bytes\n", BUFF_SIZE);
+    printf("Buffer sizes: %d to %d bytes\n", MIN_SIZE, BUFF_SIZE);
     printf("Chunks per iteration: %d\n", NB_COPY);
     printf("Number of iterations: %d\n", NB_ITER);
-    printf("Chunk size: %d bytes\n", COPY_SIZE);
     
     /*-------------------------------------------------------------------------
      * CLUSTER INITIALIZATION
      *------------------------------------------------------------------------*/
     struct pi_device cluster_dev;
     struct pi_cluster_conf conf;
-    struct pi_cluster_task cluster_task;
     
     // Initialize cluster configuration with default settings
     pi_cluster_conf_init(&conf);
@@ -192,82 +523,32 @@ static int test_entry(void)
     /*-------------------------------------------------------------------------
      * TEST DATA INITIALIZATION
      *------------------------------------------------------------------------*/
-    printf("Initializing source buffer with pseudo-random data...\n");
-    for (int i = 0; i < BUFF_SIZE; i++) {
-        ext_buff0[i] = (char)(my_rand() & 0xFF);
-    }
-    
-    // Clear destination buffer to ensure clean test
-    for (int i = 0; i < BUFF_SIZE; i++) {
-        ext_buff1[i] = 0;
-    }
-    
-    /*-------------------------------------------------------------------------
-     * PERFORMANCE MEASUREMENT SETUP
-     *------------------------------------------------------------------------*/
-    // Configure performance counter to measure cycles
-    pi_perf_conf(1 << PI_PERF_CYCLES);
-    pi_perf_reset();
-    pi_perf_start();
+    printf("Initializing source buffer with %s data...\n", data_pattern_names[DATA_PATTERN]);
+    gen_fill((uint32_t *)ext_buff0, BUFF_SIZE / 4, DATA_PATTERN, 1);
     
     /*-------------------------------------------------------------------------
-     * CLUSTER TASK EXECUTION
+     * SIZE SWEEP
      *------------------------------------------------------------------------*/
     printf("Executing DMA transfers and processing on cluster...\n");
+    int failed = sweep_sizes(&cluster_dev, 0);
     
-    // Configure cluster task
-    pi_cluster_task(&cluster_task, cluster_entry, NULL);
-    
-    // Send task to cluster and wait for completion
-    pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
-    
-    /*-------------------------------------------------------------------------
-     * PERFORMANCE MEASUREMENT
-     *------------------------------------------------------------------------*/
-    pi_perf_stop();
-    uint32_t cycles = pi_perf_read(PI_PERF_CYCLES);
-    
-    printf("DMA test completed in %u cycles\n", cycles);
-    
-    // Calculate throughput metrics
-    uint32_t total_transfers = BUFF_SIZE * 2; // Read + Write
-    float cycles_per_byte = (float)cycles / total_transfers;
-    printf("Performance: %.2f cycles per byte transferred\n", cycles_per_byte);
-    
-    /*-------------------------------------------------------------------------
-     * RESULT VERIFICATION
-     *------------------------------------------------------------------------*/
-    printf("Verifying results...\n");
-    int error_count = 0;
-    int max_errors = 10; // Limit error reporting
-    
-    for (int i = 0; i < BUFF_SIZE; i++) {
-        char expected = (char)((ext_buff0[i] * 3) & 0xFF);
-        if (ext_buff1[i] != expected) {
-            if (error_count < max_errors) {
-                printf("ERROR at index %d: expected 0x%02x, got 0x%02x (source: 0x%02x)\n",
-                       i, expected & 0xFF, ext_buff1[i] & 0xFF, ext_buff0[i] & 0xFF);
-            }
-            error_count++;
-        }
+    if (FREQ_SWEEP) {
+        failed |= freq_sweep(&cluster_dev);
     }
     
     // Print test results
-    if (error_count == 0) {
-        printf("✓ TEST PASSED: All %d bytes processed correctly\n", BUFF_SIZE);
+    if (!failed) {
+        printf("✓ TEST PASSED: All sizes processed correctly\n");
     } else {
-        printf("✗ TEST FAILED: %d errors found", error_count);
-        if (error_count > max_errors) {
-            printf(" (%d errors shown)", max_errors);
-        }
-        printf("\n");
+        printf("✗ TEST FAILED: errors found (first and count of each size shown)\n");
     }
     
     /*-------------------------------------------------------------------------
      * CLEANUP
      *------------------------------------------------------------------------*/
+    pmsis_l1_malloc_free(loc_buff, BUFF_SIZE);
     pi_cluster_close(&cluster_dev);
-    return (error_count == 0) ? 0 : -1;
+    return failed ? -1 : 0;
 }
 
 /*=============================================================================
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Convert the TRACE_BEGIN/TRACE/TRACE_END blocks printed by
+DMA_Parameter_Sweep_Test.c (built with TRACE_EVENTS=1) into a Chrome trace
+(chrome://tracing, ui.perfetto.dev) or a VCD waveform (GTKWave).
+
+Usage:
+    trace2chrome.py run.log -o trace.json
+    trace2chrome.py run.log --vcd -s 3 -o run3.vcd
+
+Every traced run becomes one process in the Chrome trace. Processing
+intervals go on one thread per core, DMA commands (issue to wait) go on
+"DMA lane" threads so that overlapping commands stay readable. Timestamps
+are cluster cycles, scaled so that the viewer shows one cycle as one
+nanosecond (the VCD output uses the same 1 ns per cycle).
+
+The VCD output holds one run (selected with -s, default 0) with a busy
+signal per core and the number of DMA commands in flight.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+BEGIN_RE = re.compile(r"TRACE_BEGIN\s+(.*)")
+EVENT_RE = re.compile(r"TRACE\s+(\d+)\s+(\d+)\s+(\w+)\s+(\d+)\s+(\d+)")
+ALL_TILES = 0xFFFF
+
+
+def parse(lines):
+    """Return a list of (title, events); an event is (core, ts, name, tile, cmd)."""
+    sections = []
+    current = None
+    for line in lines:
+        line = line.strip()
+        m = BEGIN_RE.match(line)
+        if m:
+            current = (m.group(1), [])
+            continue
+        if line.startswith("TRACE_END"):
+            if current is not None:
+                sections.append(current)
+            current = None
+            continue
+        m = EVENT_RE.match(line)
+        if m and current is not None:
+            core, ts, name, tile, cmd = m.groups()
+            current[1].append((int(core), int(ts), name, int(tile), int(cmd)))
+    return sections
+
+
+def intervals(events):
+    """Pair start/end events into (kind, core, start, end, tile, cmd) intervals."""
+    open_proc = {}
+    open_dma = {}
+    out = []
+    for core, ts, name, tile, cmd in sorted(events, key=lambda e: e[1]):
+        if name == "PROC_START":
+            open_proc[(core, tile)] = ts
+        elif name == "PROC_END" and (core, tile) in open_proc:
+            out.append(("proc", core, open_proc.pop((core, tile)), ts, tile, cmd))
+        elif name in ("READ_ISSUE", "WRITE_ISSUE"):
+            open_dma[cmd] = (name[:-6].lower(), core, ts, tile)
+        elif name in ("READ_DONE", "WRITE_DONE") and cmd in open_dma:
+            kind, issuer, start, tile = open_dma.pop(cmd)
+            out.append((kind, issuer, start, ts, tile, cmd))
+    return out
+
+
+def assign_lanes(spans):
+    """Greedy interval colouring: first lane free at the span start."""
+    lane_end = []
+    lanes = []
+    for start, end in spans:
+        for n, free_at in enumerate(lane_end):
+            if free_at <= start:
+                lane_end[n] = end
+                lanes.append(n)
+                break
+        else:
+            lane_end.append(end)
+            lanes.append(len(lane_end) - 1)
+    return lanes
+
+
+def tile_name(tile):
+    return "all" if tile == ALL_TILES else str(tile)
+
+
+def to_chrome(sections):
+    trace = []
+    for pid, (title, events) in enumerate(sections):
+        trace.append({"ph": "M", "pid": pid, "name": "process_name", "args": {"name": title}})
+        spans = intervals(events)
+        if not spans:
+            continue
+        t0 = min(s[2] for s in spans)
+
+        dma = sorted((s for s in spans if s[0] != "proc"), key=lambda s: s[2])
+        lanes = assign_lanes([(s[2], s[3]) for s in dma])
+        for n in sorted(set(lanes)):
+            trace.append({"ph": "M", "pid": pid, "tid": 100 + n, "name": "thread_name",
+                          "args": {"name": "DMA lane %d" % n}})
+        for core in sorted({s[1] for s in spans if s[0] == "proc"}):
+            trace.append({"ph": "M", "pid": pid, "tid": core, "name": "thread_name",
+                          "args": {"name": "core %d" % core}})
+
+        def emit(tid, name, kind, start, end, args):
+            # Chrome timestamps are microseconds: one cycle is written as 1 ns
+            trace.append({"ph": "X", "pid": pid, "tid": tid, "name": name, "cat": kind,
+                          "ts": (start - t0) / 1000.0, "dur": max(end - start, 1) / 1000.0,
+                          "args": args})
+
+        for kind, core, start, end, tile, cmd in spans:
+            if kind == "proc":
+                emit(core, "tile %s" % tile_name(tile), kind, start, end,
+                     {"tile": tile_name(tile)})
+        for n, (kind, core, start, end, tile, cmd) in enumerate(dma):
+            emit(100 + lanes[n], "%s %s" % (kind, tile_name(tile)), kind, start, end,
+                 {"tile": tile_name(tile), "cmd": cmd})
+    return {"traceEvents": trace, "displayTimeUnit": "ns"}
+
+
+def to_vcd(title, events):
+    spans = intervals(events)
+    cores = sorted({s[1] for s in spans if s[0] == "proc"})
+    changes = {}
+    for kind, core, start, end, _, _ in spans:
+        key = "core%d" % core if kind == "proc" else "dma"
+        changes.setdefault(start, []).append((key, +1))
+        changes.setdefault(end, []).append((key, -1))
+
+    ids = {"dma": "!"}
+    for n, core in enumerate(cores):
+        ids["core%d" % core] = chr(ord("#") + n)
+
+    out = ["$comment %s $end" % title, "$timescale 1ns $end", "$scope module cluster $end",
+           "$var integer 8 ! dma_in_flight $end"]
+    out += ["$var wire 1 %s core%d_busy $end" % (ids["core%d" % c], c) for c in cores]
+    out += ["$upscope $end", "$enddefinitions $end"]
+
+    level = {k: 0 for k in ids}
+    t0 = min(changes) if changes else 0
+    for ts in sorted(changes):
+        for key, delta in changes[ts]:
+            level[key] += delta
+        out.append("#%d" % (ts - t0))
+        out.append("b{0:b} !".format(level["dma"]))
+        out += ["%d%s" % (1 if level["core%d" % c] else 0, ids["core%d" % c]) for c in cores]
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("log", help="console output of the test ('-' for stdin)")
+    parser.add_argument("-o", "--output", help="output file (default stdout)")
+    parser.add_argument("--vcd", action="store_true", help="write a VCD file instead of JSON")
+    parser.add_argument("-s", "--section", type=int, default=0,
+                        help="traced run to export with --vcd (default 0)")
+    parser.add_argument("-l", "--list", action="store_true", help="list the traced runs")
+    args = parser.parse_args()
+
+    log = sys.stdin if args.log == "-" else open(args.log)
+    sections = parse(log)
+    if not sections:
+        sys.exit("no TRACE_BEGIN/TRACE_END block found (build with TRACE_EVENTS=1)")
+
+    if args.list:
+        for n, (title, events) in enumerate(sections):
+            print("%3d  %s  (%d events)" % (n, title, len(events)))
+        return
+
+    if args.vcd:
+        if not 0 <= args.section < len(sections):
+            sys.exit("section %d out of range (0..%d)" % (args.section, len(sections) - 1))
+        text = to_vcd(*sections[args.section])
+    else:
+        text = json.dumps(to_chrome(sections))
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()